@@ -0,0 +1,333 @@
+/*
+ * Copyright 2026 TeamOpenSmartGlasses
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Loss simulation of the LC3 forward error correction (lc3_fec).
+// Reports the frames recovered against the overhead bytes, for each
+// distance of the redundant copy, next to plain PLC.
+//
+// Usage: lc3_fec_sim [options] <pcm>
+//   -d <us>       Frame duration (10000)
+//   -r <hz>       Samplerate (16000)
+//   -n <bytes>    Size of the frames (40)
+//   -f <bytes>    Size of the redundant frames (20)
+//   -p <prob>     Gilbert-Elliott, probability to enter the bad state (0.02)
+//   -q <prob>     Gilbert-Elliott, probability to exit the bad state (0.5)
+//   -s <seed>     Seed of the loss model (1)
+//   -t <trace>    Loss trace, replacing the loss model
+//
+// The PCM input is raw 16 bits mono, at the samplerate. The loss model
+// loses the packets sent in the bad state. A loss trace gives the fate of
+// each packet, in order, as `0` (received) or `1` (lost) characters;
+// other characters are ignored and the trace is looped.
+//
+// The same losses are applied to each configuration. The SNR of the lost
+// frames is measured against a loss-free decoding of the frames.
+
+#include <getopt.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "lc3.h"
+#include "lc3_fec.h"
+
+namespace audio_util {
+namespace {
+
+constexpr double kMinSnrDb = -10;
+constexpr double kMaxSnrDb = 35;
+
+struct Options {
+  int frame_us = 10000;
+  int sample_rate_hz = 16000;
+  int frame_bytes = 40;
+  int fec_frame_bytes = 20;
+  double enter_bad = 0.02;
+  double exit_bad = 0.5;
+  unsigned seed = 1;
+  std::string trace_path;
+};
+
+struct Stats {
+  long lost = 0;
+  long recovered = 0;
+  long concealed = 0;
+  long overhead_bytes = 0;
+  double recovered_snr_sum = 0;
+  double concealed_snr_sum = 0;
+};
+
+// Returns the fate of each of `num_packets` packets, true when lost.
+std::vector<bool> GilbertElliott(const Options& options, size_t num_packets) {
+  std::mt19937 rng(options.seed);
+  std::uniform_real_distribution<double> uniform(0, 1);
+  std::vector<bool> lost(num_packets);
+  bool bad = false;
+  for (size_t i = 0; i < num_packets; i++) {
+    bad = bad ? uniform(rng) >= options.exit_bad
+              : uniform(rng) < options.enter_bad;
+    lost[i] = bad;
+  }
+  return lost;
+}
+
+bool ReadTrace(const std::string& path, size_t num_packets,
+               std::vector<bool>* lost) {
+  FILE* f = fopen(path.c_str(), "r");
+  if (f == nullptr) {
+    return false;
+  }
+  std::vector<bool> trace;
+  for (int c; (c = fgetc(f)) != EOF;) {
+    if (c == '0' || c == '1') {
+      trace.push_back(c == '1');
+    }
+  }
+  fclose(f);
+  if (trace.empty()) {
+    return false;
+  }
+  lost->resize(num_packets);
+  for (size_t i = 0; i < num_packets; i++) {
+    (*lost)[i] = trace[i % trace.size()];
+  }
+  return true;
+}
+
+double ClippedSnrDb(const int16_t* ref, const int16_t* x, int n) {
+  double signal = 0, noise = 0;
+  for (int i = 0; i < n; i++) {
+    signal += static_cast<double>(ref[i]) * ref[i];
+    noise += static_cast<double>(ref[i] - x[i]) * (ref[i] - x[i]);
+  }
+  const double snr_db = 10 * std::log10((signal + 1e-9) / (noise + 1e-9));
+  return std::min(std::max(snr_db, kMinSnrDb), kMaxSnrDb);
+}
+
+// Encodes and decodes the input with the redundant copies sent `delay`
+// packets after their frame, or without FEC when `delay` is 0. The frames
+// decoded are compared to `reference`, the loss-free decoding.
+Stats Simulate(const Options& options, int delay,
+               const std::vector<int16_t>& pcm,
+               const std::vector<int16_t>& reference,
+               const std::vector<bool>& lost) {
+  const int frame_samples =
+      lc3_frame_samples(options.frame_us, options.sample_rate_hz);
+  const size_t num_frames = pcm.size() / frame_samples;
+
+  std::vector<unsigned char> encoder_memory(
+      lc3_encoder_size(options.frame_us, options.sample_rate_hz));
+  std::vector<unsigned char> decoder_memory(
+      lc3_decoder_size(options.frame_us, options.sample_rate_hz));
+  lc3_encoder_t encoder = lc3_setup_encoder(
+      options.frame_us, options.sample_rate_hz, 0, encoder_memory.data());
+  lc3_decoder_t decoder = lc3_setup_decoder(
+      options.frame_us, options.sample_rate_hz, 0, decoder_memory.data());
+
+  lc3_fec_encoder_t fec_encoder;
+  lc3_fec_decoder_t fec_decoder;
+  if (delay > 0) {
+    lc3_fec_setup_encoder(&fec_encoder, options.frame_bytes,
+                          options.fec_frame_bytes, delay);
+    lc3_fec_setup_decoder(&fec_decoder, options.frame_bytes,
+                          options.fec_frame_bytes, delay);
+  }
+
+  Stats stats;
+  std::vector<unsigned char> packet(options.frame_bytes +
+                                    options.fec_frame_bytes);
+  std::vector<int16_t> output(frame_samples);
+
+  // The last `delay` calls drain the decoder, with lost packets.
+  for (size_t i = 0; i < num_frames + delay; i++) {
+    const bool packet_lost = i >= num_frames || lost[i];
+    int ret;
+    if (delay > 0) {
+      if (i < num_frames) {
+        lc3_fec_encode(&fec_encoder, encoder, LC3_PCM_FORMAT_S16,
+                       pcm.data() + i * frame_samples, 1, packet.data());
+        stats.overhead_bytes += options.fec_frame_bytes;
+      }
+      ret = lc3_fec_decode(&fec_decoder, decoder,
+                           packet_lost ? nullptr : packet.data(),
+                           LC3_PCM_FORMAT_S16, output.data(), 1);
+    } else {
+      lc3_encode(encoder, LC3_PCM_FORMAT_S16, pcm.data() + i * frame_samples,
+                 1, options.frame_bytes, packet.data());
+      ret = lc3_decode(decoder, packet_lost ? nullptr : packet.data(),
+                       options.frame_bytes, LC3_PCM_FORMAT_S16,
+                       output.data(), 1);
+    }
+
+    if (i < static_cast<size_t>(delay) || !lost[i - delay]) {
+      continue;
+    }
+
+    const size_t frame = i - delay;
+    const double snr_db = ClippedSnrDb(
+        reference.data() + frame * frame_samples, output.data(),
+        frame_samples);
+    stats.lost++;
+    if (ret == 2) {
+      stats.recovered++;
+      stats.recovered_snr_sum += snr_db;
+    } else {
+      stats.concealed++;
+      stats.concealed_snr_sum += snr_db;
+    }
+  }
+
+  return stats;
+}
+
+// Loss-free decoding of the frames of `frame_bytes` size.
+std::vector<int16_t> Reference(const Options& options,
+                               const std::vector<int16_t>& pcm) {
+  const int frame_samples =
+      lc3_frame_samples(options.frame_us, options.sample_rate_hz);
+  const size_t num_frames = pcm.size() / frame_samples;
+
+  std::vector<unsigned char> encoder_memory(
+      lc3_encoder_size(options.frame_us, options.sample_rate_hz));
+  std::vector<unsigned char> decoder_memory(
+      lc3_decoder_size(options.frame_us, options.sample_rate_hz));
+  lc3_encoder_t encoder = lc3_setup_encoder(
+      options.frame_us, options.sample_rate_hz, 0, encoder_memory.data());
+  lc3_decoder_t decoder = lc3_setup_decoder(
+      options.frame_us, options.sample_rate_hz, 0, decoder_memory.data());
+
+  std::vector<unsigned char> frame(options.frame_bytes);
+  std::vector<int16_t> reference(num_frames * frame_samples);
+  for (size_t i = 0; i < num_frames; i++) {
+    lc3_encode(encoder, LC3_PCM_FORMAT_S16, pcm.data() + i * frame_samples, 1,
+               options.frame_bytes, frame.data());
+    lc3_decode(decoder, frame.data(), options.frame_bytes,
+               LC3_PCM_FORMAT_S16, reference.data() + i * frame_samples, 1);
+  }
+  return reference;
+}
+
+void Print(const char* name, const Stats& stats, long num_frames,
+           const Options& options) {
+  printf("%-8s %8.1f%% %8ld %10ld %8.1f%% %10.2f %10.2f\n", name,
+         100. * stats.overhead_bytes /
+             std::max(num_frames * options.frame_bytes, 1L),
+         stats.lost, stats.recovered,
+         100. * stats.recovered / std::max(stats.lost, 1L),
+         stats.recovered > 0 ? stats.recovered_snr_sum / stats.recovered : 0.,
+         stats.concealed > 0 ? stats.concealed_snr_sum / stats.concealed
+                             : 0.);
+}
+
+bool ReadPcm(const char* path, std::vector<int16_t>* pcm) {
+  FILE* f = fopen(path, "rb");
+  if (f == nullptr) {
+    return false;
+  }
+  int16_t buffer[4096];
+  for (size_t n; (n = fread(buffer, sizeof(*buffer), 4096, f)) > 0;) {
+    pcm->insert(pcm->end(), buffer, buffer + n);
+  }
+  fclose(f);
+  return true;
+}
+
+void Usage(const char* name) {
+  fprintf(stderr,
+          "Usage: %s [-d frame_us] [-r samplerate_hz] [-n frame_bytes]\n"
+          "       [-f fec_frame_bytes] [-p enter_bad] [-q exit_bad] "
+          "[-s seed]\n"
+          "       [-t trace] <pcm>\n",
+          name);
+}
+
+}  // namespace
+}  // namespace audio_util
+
+int main(int argc, char** argv) {
+  using namespace audio_util;
+
+  Options options;
+  for (int opt; (opt = getopt(argc, argv, "d:r:n:f:p:q:s:t:")) != -1;) {
+    switch (opt) {
+      case 'd': options.frame_us = atoi(optarg); break;
+      case 'r': options.sample_rate_hz = atoi(optarg); break;
+      case 'n': options.frame_bytes = atoi(optarg); break;
+      case 'f': options.fec_frame_bytes = atoi(optarg); break;
+      case 'p': options.enter_bad = atof(optarg); break;
+      case 'q': options.exit_bad = atof(optarg); break;
+      case 's': options.seed = strtoul(optarg, nullptr, 0); break;
+      case 't': options.trace_path = optarg; break;
+      default:
+        Usage(argv[0]);
+        return 1;
+    }
+  }
+  if (argc - optind != 1) {
+    Usage(argv[0]);
+    return 1;
+  }
+
+  lc3_fec_encoder_t fec;
+  const int frame_samples =
+      lc3_frame_samples(options.frame_us, options.sample_rate_hz);
+  if (frame_samples < 0 ||
+      lc3_fec_setup_encoder(&fec, options.frame_bytes,
+                            options.fec_frame_bytes, 1) < 0) {
+    fprintf(stderr, "Bad LC3 or FEC parameters\n");
+    return 1;
+  }
+
+  std::vector<int16_t> pcm;
+  if (!ReadPcm(argv[optind], &pcm)) {
+    fprintf(stderr, "%s: cannot read\n", argv[optind]);
+    return 1;
+  }
+  const size_t num_frames = pcm.size() / frame_samples;
+
+  std::vector<bool> lost;
+  if (options.trace_path.empty()) {
+    lost = GilbertElliott(options, num_frames);
+  } else if (!ReadTrace(options.trace_path, num_frames, &lost)) {
+    fprintf(stderr, "%s: cannot read trace\n", options.trace_path.c_str());
+    return 1;
+  }
+
+  const std::vector<int16_t> reference = Reference(options, pcm);
+
+  printf("%zu frames of %d bytes, %ld lost (%.1f%%)\n\n", num_frames,
+         options.frame_bytes,
+         static_cast<long>(std::count(lost.begin(), lost.end(), true)),
+         100. * std::count(lost.begin(), lost.end(), true) /
+             std::max<size_t>(num_frames, 1));
+  printf("%-8s %9s %8s %10s %9s %10s %10s\n", "", "overhead", "lost",
+         "recovered", "rate", "snr rec", "snr plc");
+
+  Print("plc", Simulate(options, 0, pcm, reference, lost), num_frames,
+        options);
+  for (int delay = 1; delay <= LC3_FEC_MAX_DELAY; delay++) {
+    char name[16];
+    snprintf(name, sizeof(name), "delay %d", delay);
+    Print(name, Simulate(options, delay, pcm, reference, lost), num_frames,
+          options);
+  }
+
+  return 0;
+}
@@ -0,0 +1,309 @@
+/*
+ * Copyright 2026 TeamOpenSmartGlasses
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Replay of link traces through the LC3 rate controller (lc3_ratectl).
+// Reports the quality of the decoded audio against the airtime, next to
+// the fixed 20 bytes frames sent by the glasses.
+//
+// Usage: lc3_ratectl_replay [options] <pcm> <trace>
+//   -d <us>       Frame duration (10000)
+//   -r <hz>       Samplerate (16000)
+//   -m <bytes>    Minimum size of the frames (20)
+//   -M <bytes>    Maximum size of the frames (255)
+//   -v            Print the size selected after each report
+//
+// The PCM input is raw 16 bits mono, at the samplerate. The trace gives
+// one report of the link per line, `<queue> <sent> <lost> <throughput>`,
+// with the queue depth in frames and the throughput in bps (0 unknown).
+// Lines starting with `#` are ignored. A report covers the `sent + lost`
+// frames following the previous one; the lost frames are spread over the
+// interval and concealed by the decoder. The replay stops at the end of
+// the trace or of the PCM input.
+//
+// The quality is the segmental SNR of the decoded audio, over the frames
+// of the input above -50 dBFS, each frame clipped to [-10, 35] dB.
+
+#include <getopt.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "lc3.h"
+#include "lc3_ratectl.h"
+
+namespace audio_util {
+namespace {
+
+constexpr int kFixedFrameBytes = 20;
+
+constexpr double kSilenceDb = -50;
+constexpr double kMinSnrDb = -10;
+constexpr double kMaxSnrDb = 35;
+
+struct Options {
+  int frame_us = 10000;
+  int sample_rate_hz = 16000;
+  int min_frame_bytes = 20;
+  int max_frame_bytes = LC3_RATECTL_MAX_FRAME_BYTES;
+  bool verbose = false;
+};
+
+struct Report {
+  int queue;
+  int sent, lost;
+  int throughput;
+};
+
+// Encoding and decoding chain, with its quality and airtime counters.
+class Chain {
+ public:
+  explicit Chain(const Options& options)
+      : frame_us_(options.frame_us),
+        frame_samples_(
+            lc3_frame_samples(options.frame_us, options.sample_rate_hz)),
+        delay_(lc3_delay_samples(options.frame_us, options.sample_rate_hz)),
+        encoder_memory_(
+            lc3_encoder_size(options.frame_us, options.sample_rate_hz)),
+        decoder_memory_(
+            lc3_decoder_size(options.frame_us, options.sample_rate_hz)),
+        buffer_(LC3_RATECTL_HEADER_BYTES + LC3_MAX_FRAME_BYTES),
+        output_(frame_samples_),
+        history_(delay_ + frame_samples_) {
+    encoder_ = lc3_setup_encoder(options.frame_us, options.sample_rate_hz, 0,
+                                 encoder_memory_.data());
+    decoder_ = lc3_setup_decoder(options.frame_us, options.sample_rate_hz, 0,
+                                 decoder_memory_.data());
+  }
+
+  // Encodes a frame with the rate controller, or with fixed size frames
+  // when `ctl` is null, and decodes it or conceals it when `lost`.
+  void Process(lc3_ratectl_t* ctl, const int16_t* pcm, bool lost) {
+    int size;
+    if (ctl != nullptr) {
+      size = lc3_ratectl_encode(ctl, encoder_, LC3_PCM_FORMAT_S16, pcm, 1,
+                                buffer_.data());
+    } else {
+      size = kFixedFrameBytes;
+      lc3_encode(encoder_, LC3_PCM_FORMAT_S16, pcm, 1, size, buffer_.data());
+    }
+
+    if (lost) {
+      lc3_decode(decoder_, nullptr, 0, LC3_PCM_FORMAT_S16, output_.data(), 1);
+    } else if (ctl != nullptr) {
+      lc3_ratectl_decode(decoder_, buffer_.data(), size, LC3_PCM_FORMAT_S16,
+                         output_.data(), 1);
+    } else {
+      lc3_decode(decoder_, buffer_.data(), size, LC3_PCM_FORMAT_S16,
+                 output_.data(), 1);
+    }
+
+    num_frames_++;
+    num_lost_ += lost;
+    airtime_bytes_ += size;
+    Measure(pcm);
+  }
+
+  void Print(const char* name) const {
+    const double seconds = num_frames_ * frame_us_ * 1e-6;
+    printf("%-10s %8ld %8ld %10ld %8.1f %10.2f\n", name, num_frames_,
+           num_lost_, airtime_bytes_,
+           airtime_bytes_ * 8e-3 / std::max(seconds, 1e-9),
+           num_snr_frames_ > 0 ? snr_sum_ / num_snr_frames_ : 0.);
+  }
+
+ private:
+  // Accumulates the SNR of the decoded frame, against the input delayed
+  // by the algorithmic delay of the codec.
+  void Measure(const int16_t* pcm) {
+    std::copy(pcm, pcm + frame_samples_, history_.begin() + delay_);
+
+    if (num_frames_ * frame_samples_ > delay_) {
+      double signal = 0, noise = 0;
+      for (int i = 0; i < frame_samples_; i++) {
+        const double x = history_[i];
+        signal += x * x;
+        noise += (x - output_[i]) * (x - output_[i]);
+      }
+
+      const double level_db =
+          10 * std::log10(signal / frame_samples_ / (32768. * 32768.) + 1e-20);
+      if (level_db > kSilenceDb) {
+        const double snr_db = 10 * std::log10(signal / (noise + 1e-9));
+        snr_sum_ += std::min(std::max(snr_db, kMinSnrDb), kMaxSnrDb);
+        num_snr_frames_++;
+      }
+    }
+
+    std::copy(history_.begin() + frame_samples_, history_.end(),
+              history_.begin());
+  }
+
+  int frame_us_;
+  int frame_samples_;
+  int delay_;
+
+  std::vector<unsigned char> encoder_memory_;
+  std::vector<unsigned char> decoder_memory_;
+  lc3_encoder_t encoder_;
+  lc3_decoder_t decoder_;
+
+  std::vector<unsigned char> buffer_;
+  std::vector<int16_t> output_;
+  std::vector<int16_t> history_;
+
+  long num_frames_ = 0;
+  long num_lost_ = 0;
+  long airtime_bytes_ = 0;
+  double snr_sum_ = 0;
+  long num_snr_frames_ = 0;
+};
+
+bool ReadPcm(const char* path, std::vector<int16_t>* pcm) {
+  FILE* f = fopen(path, "rb");
+  if (f == nullptr) {
+    return false;
+  }
+  int16_t buffer[4096];
+  for (size_t n; (n = fread(buffer, sizeof(*buffer), 4096, f)) > 0;) {
+    pcm->insert(pcm->end(), buffer, buffer + n);
+  }
+  fclose(f);
+  return true;
+}
+
+bool ReadTrace(const char* path, std::vector<Report>* trace) {
+  FILE* f = fopen(path, "r");
+  if (f == nullptr) {
+    return false;
+  }
+  char line[256];
+  for (int lineno = 1; fgets(line, sizeof(line), f) != nullptr; lineno++) {
+    Report report;
+    if (line[0] == '#' || strspn(line, " \t\r\n") == strlen(line)) {
+      continue;
+    }
+    if (sscanf(line, "%d %d %d %d", &report.queue, &report.sent,
+               &report.lost, &report.throughput) != 4 ||
+        report.queue < 0 || report.sent < 0 || report.lost < 0 ||
+        report.throughput < 0) {
+      fprintf(stderr, "%s:%d: bad report\n", path, lineno);
+      fclose(f);
+      return false;
+    }
+    trace->push_back(report);
+  }
+  fclose(f);
+  return true;
+}
+
+void Usage(const char* name) {
+  fprintf(stderr,
+          "Usage: %s [-d frame_us] [-r samplerate_hz] [-m min_bytes]\n"
+          "       [-M max_bytes] [-v] <pcm> <trace>\n",
+          name);
+}
+
+}  // namespace
+}  // namespace audio_util
+
+int main(int argc, char** argv) {
+  using namespace audio_util;
+
+  Options options;
+  for (int opt; (opt = getopt(argc, argv, "d:r:m:M:v")) != -1;) {
+    switch (opt) {
+      case 'd': options.frame_us = atoi(optarg); break;
+      case 'r': options.sample_rate_hz = atoi(optarg); break;
+      case 'm': options.min_frame_bytes = atoi(optarg); break;
+      case 'M': options.max_frame_bytes = atoi(optarg); break;
+      case 'v': options.verbose = true; break;
+      default:
+        Usage(argv[0]);
+        return 1;
+    }
+  }
+  if (argc - optind != 2) {
+    Usage(argv[0]);
+    return 1;
+  }
+
+  lc3_ratectl_t ctl;
+  const int frame_samples =
+      lc3_frame_samples(options.frame_us, options.sample_rate_hz);
+  if (frame_samples < 0 ||
+      lc3_ratectl_setup(&ctl, options.frame_us, options.min_frame_bytes,
+                        options.max_frame_bytes) < 0) {
+    fprintf(stderr, "Bad LC3 or rate control parameters\n");
+    return 1;
+  }
+
+  std::vector<int16_t> pcm;
+  std::vector<Report> trace;
+  if (!ReadPcm(argv[optind], &pcm)) {
+    fprintf(stderr, "%s: cannot read\n", argv[optind]);
+    return 1;
+  }
+  if (!ReadTrace(argv[optind + 1], &trace)) {
+    return 1;
+  }
+
+  Chain adaptive(options), fixed(options);
+  std::vector<long> histogram(LC3_RATECTL_MAX_FRAME_BYTES + 1);
+  const size_t num_frames = pcm.size() / frame_samples;
+
+  size_t frame = 0;
+  for (size_t i = 0; i < trace.size() && frame < num_frames; i++) {
+    const Report& report = trace[i];
+    const int n = report.sent + report.lost;
+
+    for (int j = 0; j < n && frame < num_frames; j++, frame++) {
+      const int16_t* x = pcm.data() + frame * frame_samples;
+      const bool lost =
+          (j + 1) * report.lost / n != j * report.lost / n;
+
+      histogram[lc3_ratectl_nbytes(&ctl)]++;
+      adaptive.Process(&ctl, x, lost);
+      fixed.Process(nullptr, x, lost);
+    }
+
+    const struct lc3_ratectl_link link = {
+        report.queue, report.sent, report.lost, report.throughput};
+    lc3_ratectl_update(&ctl, &link);
+
+    if (options.verbose) {
+      printf("report %zu: queue %d, sent %d, lost %d, %d bps -> %d bytes\n",
+             i + 1, report.queue, report.sent, report.lost,
+             report.throughput, lc3_ratectl_nbytes(&ctl));
+    }
+  }
+
+  printf("%-10s %8s %8s %10s %8s %10s\n", "", "frames", "lost", "bytes",
+         "kbps", "snr dB");
+  adaptive.Print("adaptive");
+  fixed.Print("fixed");
+
+  printf("\nsize    frames\n");
+  for (size_t nbytes = 0; nbytes < histogram.size(); nbytes++) {
+    if (histogram[nbytes] > 0) {
+      printf("%4zu %10ld\n", nbytes, histogram[nbytes]);
+    }
+  }
+
+  return 0;
+}
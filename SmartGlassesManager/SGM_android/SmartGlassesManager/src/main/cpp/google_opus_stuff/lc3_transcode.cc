@@ -0,0 +1,468 @@
+/*
+ * Copyright 2026 TeamOpenSmartGlasses
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Offline transcoder of raw LC3 dumps, as written by the cloud debug
+// audio-writer (`<user>_lc3.raw`): a sequence of fixed size LC3 frames,
+// without any framing.
+//
+// Usage: lc3_transcode [options] <dump>...
+//   -f wav|opus   Output format (wav)
+//   -o <dir>      Output directory (next to the input)
+//   -j <threads>  Number of worker threads (number of cores)
+//   -n <bytes>    Size of the LC3 frames (20)
+//   -d <us>       Frame duration, 7500 or 10000 (10000)
+//   -r <hz>       Samplerate (16000)
+//   -b <bps>      Opus bitrate (24000)
+//
+// The files are spread over the workers, biggest first. A worker running
+// out of files steals from the back of the queue of another worker.
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ogg_opus_encoder.h"
+#include "lc3.h"
+
+namespace audio_util {
+namespace {
+
+// Outputs are written by chunks of this size.
+constexpr size_t kWriteChunkSize = 1 << 20;
+
+// Number of frames passed at once to the Opus encoder.
+constexpr int kOpusBatchFrames = 50;
+
+constexpr int kWavHeaderSize = 44;
+
+enum class Format { kWav, kOpus };
+
+struct Options {
+  Format format = Format::kWav;
+  std::string output_dir;
+  int num_threads = 0;
+  int frame_bytes = 20;
+  int frame_us = 10000;
+  int sample_rate_hz = 16000;
+  int opus_bitrate_bps = 24000;
+};
+
+struct Job {
+  std::string input_path;
+  std::string output_path;
+  off_t size;
+};
+
+struct Stats {
+  bool ok = false;
+  double audio_seconds = 0;
+  double wall_seconds = 0;
+};
+
+// Read-only mapping of a whole file.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        madvise(data, st.st_size, MADV_SEQUENTIAL);
+        data_ = static_cast<const unsigned char*>(data);
+        size_ = st.st_size;
+      }
+    }
+    close(fd);
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      munmap(const_cast<unsigned char*>(data_), size_);
+    }
+  }
+
+  const unsigned char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const unsigned char* data_;
+  size_t size_;
+};
+
+// Output file, written sequentially by large chunks.
+class ChunkedWriter {
+ public:
+  explicit ChunkedWriter(const std::string& path)
+      : fd_(open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)),
+        ok_(fd_ >= 0) {
+    buffer_.reserve(kWriteChunkSize);
+  }
+
+  ~ChunkedWriter() {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  void Append(const void* data, size_t size) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    buffer_.insert(buffer_.end(), p, p + size);
+    if (buffer_.size() >= kWriteChunkSize) {
+      Flush();
+    }
+  }
+
+  void Flush() {
+    const unsigned char* p = buffer_.data();
+    for (size_t n = buffer_.size(); ok_ && n > 0;) {
+      const ssize_t written = write(fd_, p, n);
+      ok_ = written > 0;
+      p += ok_ ? written : 0;
+      n -= ok_ ? written : 0;
+    }
+    buffer_.clear();
+  }
+
+  // Rewrites `size` bytes at the beginning of the file, after a flush.
+  void Rewrite(const void* data, size_t size) {
+    Flush();
+    ok_ = ok_ && pwrite(fd_, data, size, 0) == static_cast<ssize_t>(size);
+  }
+
+  bool ok() const { return ok_; }
+
+ private:
+  int fd_;
+  bool ok_;
+  std::vector<unsigned char> buffer_;
+};
+
+void PutUint16(unsigned char* p, uint16_t value) {
+  p[0] = value;
+  p[1] = value >> 8;
+}
+
+void PutUint32(unsigned char* p, uint32_t value) {
+  PutUint16(p, value);
+  PutUint16(p + 2, value >> 16);
+}
+
+void MakeWavHeader(int sample_rate_hz, uint32_t data_size,
+                   unsigned char* header) {
+  memcpy(header, "RIFF", 4);
+  PutUint32(header + 4, 36 + data_size);
+  memcpy(header + 8, "WAVEfmt ", 8);
+  PutUint32(header + 16, 16);
+  PutUint16(header + 20, 1);  // PCM
+  PutUint16(header + 22, 1);  // Mono
+  PutUint32(header + 24, sample_rate_hz);
+  PutUint32(header + 28, sample_rate_hz * 2);
+  PutUint16(header + 32, 2);
+  PutUint16(header + 34, 16);
+  memcpy(header + 36, "data", 4);
+  PutUint32(header + 40, data_size);
+}
+
+std::string OutputPath(const std::string& input, const Options& options) {
+  std::string name = input;
+  std::string dir;
+  const size_t slash = name.rfind('/');
+  if (slash != std::string::npos) {
+    dir = name.substr(0, slash + 1);
+    name = name.substr(slash + 1);
+  }
+  const size_t dot = name.rfind('.');
+  if (dot != std::string::npos && dot > 0) {
+    name.resize(dot);
+  }
+  if (!options.output_dir.empty()) {
+    dir = options.output_dir + "/";
+  }
+  return dir + name + (options.format == Format::kWav ? ".wav" : ".opus");
+}
+
+Stats Transcode(const Job& job, const Options& options) {
+  Stats stats;
+  const auto start = std::chrono::steady_clock::now();
+
+  MappedFile input(job.input_path);
+  if (input.data() == nullptr) {
+    fprintf(stderr, "%s: cannot map input\n", job.input_path.c_str());
+    return stats;
+  }
+  ChunkedWriter output(job.output_path);
+  if (!output.ok()) {
+    fprintf(stderr, "%s: cannot create output\n", job.output_path.c_str());
+    return stats;
+  }
+
+  const int frame_samples =
+      lc3_frame_samples(options.frame_us, options.sample_rate_hz);
+  const size_t num_frames = input.size() / options.frame_bytes;
+  if (input.size() % options.frame_bytes != 0) {
+    fprintf(stderr, "%s: ignoring %zu trailing bytes\n",
+            job.input_path.c_str(), input.size() % options.frame_bytes);
+  }
+
+  std::vector<unsigned char> decoder_memory(
+      lc3_decoder_size(options.frame_us, options.sample_rate_hz));
+  lc3_decoder_t decoder =
+      lc3_setup_decoder(options.frame_us, options.sample_rate_hz, 0,
+                        decoder_memory.data());
+
+  std::unique_ptr<OggOpusEncoder> encoder;
+  if (options.format == Format::kOpus) {
+    encoder.reset(new OggOpusEncoder(1, options.sample_rate_hz,
+                                     options.opus_bitrate_bps,
+                                     true /* use_vbr */,
+                                     false /* low_latency_mode */));
+  } else {
+    unsigned char header[kWavHeaderSize] = {};
+    output.Append(header, sizeof(header));
+  }
+
+  std::vector<int16_t> pcm(kOpusBatchFrames * frame_samples);
+  const unsigned char* frame = input.data();
+  for (size_t i = 0; i < num_frames;) {
+    const int batch =
+        static_cast<int>(std::min<size_t>(kOpusBatchFrames, num_frames - i));
+    for (int j = 0; j < batch; j++, frame += options.frame_bytes) {
+      lc3_decode(decoder, frame, options.frame_bytes, LC3_PCM_FORMAT_S16,
+                 pcm.data() + j * frame_samples, 1);
+    }
+    i += batch;
+
+    if (encoder != nullptr) {
+      pcm.resize(batch * frame_samples);
+      const std::vector<unsigned char>& ogg = encoder->Process(pcm);
+      output.Append(ogg.data(), ogg.size());
+    } else {
+      output.Append(pcm.data(), batch * frame_samples * sizeof(int16_t));
+    }
+  }
+
+  if (encoder != nullptr) {
+    const std::vector<unsigned char>& ogg = encoder->Flush();
+    output.Append(ogg.data(), ogg.size());
+    output.Flush();
+  } else {
+    unsigned char header[kWavHeaderSize];
+    MakeWavHeader(options.sample_rate_hz,
+                  num_frames * frame_samples * sizeof(int16_t), header);
+    output.Rewrite(header, sizeof(header));
+  }
+
+  if (!output.ok()) {
+    fprintf(stderr, "%s: write error\n", job.output_path.c_str());
+    return stats;
+  }
+
+  stats.ok = true;
+  stats.audio_seconds = num_frames * options.frame_us * 1e-6;
+  stats.wall_seconds = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+  return stats;
+}
+
+// Per worker queue of jobs. The owner pops from the front, thieves from
+// the back, so that the biggest files are started first.
+class JobQueue {
+ public:
+  void Push(int job) { jobs_.push_back(job); }
+
+  bool Pop(int* job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty()) {
+      return false;
+    }
+    *job = jobs_.front();
+    jobs_.pop_front();
+    return true;
+  }
+
+  bool Steal(int* job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty()) {
+      return false;
+    }
+    *job = jobs_.back();
+    jobs_.pop_back();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<int> jobs_;
+};
+
+std::vector<Stats> TranscodeAll(const std::vector<Job>& jobs,
+                                const Options& options, int num_threads) {
+  std::vector<Stats> stats(jobs.size());
+  std::vector<JobQueue> queues(num_threads);
+  std::mutex print_mutex;
+
+  std::vector<int> order(jobs.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(),
+            [&](int a, int b) { return jobs[a].size > jobs[b].size; });
+  for (size_t i = 0; i < order.size(); i++) {
+    queues[i % num_threads].Push(order[i]);
+  }
+
+  auto worker = [&](int id) {
+    int job;
+    for (;;) {
+      bool found = queues[id].Pop(&job);
+      for (int i = 1; !found && i < num_threads; i++) {
+        found = queues[(id + i) % num_threads].Steal(&job);
+      }
+      if (!found) {
+        break;
+      }
+
+      stats[job] = Transcode(jobs[job], options);
+      if (stats[job].ok) {
+        std::lock_guard<std::mutex> lock(print_mutex);
+        printf("%s: %.1f s in %.3f s, %.1fx realtime\n",
+               jobs[job].output_path.c_str(), stats[job].audio_seconds,
+               stats[job].wall_seconds,
+               stats[job].audio_seconds /
+                   std::max(stats[job].wall_seconds, 1e-9));
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; i++) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  return stats;
+}
+
+void Usage(const char* name) {
+  fprintf(stderr,
+          "Usage: %s [-f wav|opus] [-o dir] [-j threads] [-n frame_bytes]\n"
+          "       [-d frame_us] [-r samplerate_hz] [-b opus_bitrate] "
+          "<dump>...\n",
+          name);
+}
+
+}  // namespace
+}  // namespace audio_util
+
+int main(int argc, char** argv) {
+  using namespace audio_util;
+
+  Options options;
+  for (int opt; (opt = getopt(argc, argv, "f:o:j:n:d:r:b:")) != -1;) {
+    switch (opt) {
+      case 'f':
+        if (strcmp(optarg, "wav") != 0 && strcmp(optarg, "opus") != 0) {
+          Usage(argv[0]);
+          return 1;
+        }
+        options.format = optarg[0] == 'w' ? Format::kWav : Format::kOpus;
+        break;
+      case 'o': options.output_dir = optarg; break;
+      case 'j': options.num_threads = atoi(optarg); break;
+      case 'n': options.frame_bytes = atoi(optarg); break;
+      case 'd': options.frame_us = atoi(optarg); break;
+      case 'r': options.sample_rate_hz = atoi(optarg); break;
+      case 'b': options.opus_bitrate_bps = atoi(optarg); break;
+      default:
+        Usage(argv[0]);
+        return 1;
+    }
+  }
+  if (optind >= argc) {
+    Usage(argv[0]);
+    return 1;
+  }
+
+  if (lc3_frame_samples(options.frame_us, options.sample_rate_hz) < 0 ||
+      options.frame_bytes < LC3_MIN_FRAME_BYTES ||
+      options.frame_bytes > LC3_MAX_FRAME_BYTES) {
+    fprintf(stderr, "Bad LC3 parameters\n");
+    return 1;
+  }
+  if (options.format == Format::kOpus && options.sample_rate_hz != 8000 &&
+      options.sample_rate_hz != 16000 && options.sample_rate_hz != 24000 &&
+      options.sample_rate_hz != 48000) {
+    fprintf(stderr, "Samplerate not supported by Opus\n");
+    return 1;
+  }
+
+  std::vector<Job> jobs;
+  for (int i = optind; i < argc; i++) {
+    struct stat st;
+    if (stat(argv[i], &st) != 0) {
+      fprintf(stderr, "%s: not found\n", argv[i]);
+      continue;
+    }
+    jobs.push_back({argv[i], OutputPath(argv[i], options), st.st_size});
+  }
+
+  int num_threads = options.num_threads;
+  if (num_threads <= 0) {
+    num_threads = std::thread::hardware_concurrency();
+  }
+  num_threads = std::max(1, std::min<int>(num_threads, jobs.size()));
+
+  const auto start = std::chrono::steady_clock::now();
+  const std::vector<Stats> stats = TranscodeAll(jobs, options, num_threads);
+  const double wall_seconds = std::chrono::duration<double>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count();
+
+  int num_failed = 0;
+  double audio_seconds = 0, busy_seconds = 0;
+  for (const Stats& s : stats) {
+    num_failed += !s.ok;
+    audio_seconds += s.audio_seconds;
+    busy_seconds += s.wall_seconds;
+  }
+
+  printf("%zu files, %.1f s of audio in %.3f s on %d threads: "
+         "%.1fx realtime (%.1fx per thread)\n",
+         jobs.size() - num_failed, audio_seconds, wall_seconds, num_threads,
+         audio_seconds / std::max(wall_seconds, 1e-9),
+         audio_seconds / std::max(busy_seconds, 1e-9));
+
+  return num_failed > 0 || jobs.size() < static_cast<size_t>(argc - optind);
+}
@@ -0,0 +1,383 @@
+/*
+ * Copyright 2026 TeamOpenSmartGlasses
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ogg_opus_decoder.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+// Ogg framing comes from https://tools.ietf.org/html/rfc3533 and the Opus
+// mapping from https://tools.ietf.org/html/rfc7845.
+
+namespace audio_util {
+namespace {
+
+// Fixed part of the Ogg page header, before the segment table.
+constexpr int kPageHeaderSize = 27;
+
+// Largest Opus packet is 120ms.
+constexpr int kMaxFrameSize = 120 * OggOpusDecoder::kSampleRateHz / 1000;
+
+// Decoding starts 80ms before a seek target, for the decoder to converge.
+constexpr int kSeekPreRoll = 80 * OggOpusDecoder::kSampleRateHz / 1000;
+
+int64_t ReadInt64(const unsigned char* p) {
+  uint64_t value = 0;
+  for (int i = 7; i >= 0; i--) value = (value << 8) | p[i];
+  return static_cast<int64_t>(value);
+}
+
+uint32_t ReadUint32(const unsigned char* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+}  // namespace
+
+OggOpusDecoder::OggOpusDecoder(const unsigned char* data, size_t size)
+    : data_(data),
+      size_(size),
+      mapping_(nullptr),
+      decoder_(nullptr, opus_multistream_decoder_destroy),
+      first_audio_page_(0),
+      next_page_(0),
+      num_samples_(0),
+      end_granule_position_(0),
+      next_packet_(0),
+      packet_granule_position_(-1),
+      pcm_offset_(0),
+      pcm_count_(0),
+      discard_until_(0),
+      position_(0) {
+  ogg_stream_init(&stream_, 0 /* serial number, set by Init() */);
+}
+
+OggOpusDecoder::~OggOpusDecoder() {
+  ogg_stream_clear(&stream_);
+  if (mapping_ != nullptr) {
+    munmap(mapping_, size_);
+  }
+}
+
+std::unique_ptr<OggOpusDecoder> OggOpusDecoder::Create(
+    const unsigned char* data, size_t size) {
+  std::unique_ptr<OggOpusDecoder> decoder(new OggOpusDecoder(data, size));
+  if (!decoder->Init()) {
+    return nullptr;
+  }
+  return decoder;
+}
+
+std::unique_ptr<OggOpusDecoder> OggOpusDecoder::CreateFromFile(
+    const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  const size_t size = st.st_size;
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping remains valid after closing the file descriptor.
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return nullptr;
+  }
+  // Pages are read once to build the index, then mostly sequentially.
+  madvise(mapping, size, MADV_SEQUENTIAL);
+
+  std::unique_ptr<OggOpusDecoder> decoder =
+      Create(static_cast<const unsigned char*>(mapping), size);
+  if (decoder == nullptr) {
+    munmap(mapping, size);
+    return nullptr;
+  }
+  decoder->mapping_ = mapping;
+  return decoder;
+}
+
+std::vector<std::vector<int16_t>> OggOpusDecoder::DecodeFiles(
+    const std::vector<std::string>& paths, int num_threads) {
+  std::vector<std::vector<int16_t>> results(paths.size());
+  std::atomic<size_t> next_file(0);
+
+  auto worker = [&]() {
+    for (size_t i = next_file++; i < paths.size(); i = next_file++) {
+      std::unique_ptr<OggOpusDecoder> decoder = CreateFromFile(paths[i]);
+      if (decoder == nullptr) {
+        continue;
+      }
+      const int num_channels = decoder->num_channels();
+      std::vector<int16_t>& pcm = results[i];
+      pcm.resize(decoder->num_samples() * num_channels);
+      int64_t decoded = 0;
+      while (decoded < decoder->num_samples()) {
+        const int max_samples = static_cast<int>(
+            std::min<int64_t>(decoder->num_samples() - decoded, kMaxFrameSize));
+        const int n =
+            decoder->Decode(pcm.data() + decoded * num_channels, max_samples);
+        if (n <= 0) {
+          break;
+        }
+        decoded += n;
+      }
+      pcm.resize(decoded * num_channels);
+    }
+  };
+
+  num_threads = std::max(1, std::min<int>(num_threads, paths.size()));
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  return results;
+}
+
+bool OggOpusDecoder::ParsePage(size_t offset, Page* page) const {
+  if (size_ < kPageHeaderSize || offset > size_ - kPageHeaderSize) {
+    return false;
+  }
+  const unsigned char* p = data_ + offset;
+  if (memcmp(p, "OggS", 4) != 0) {
+    return false;
+  }
+  const int num_segments = p[26];
+  size_t page_size = kPageHeaderSize + num_segments;
+  if (page_size > size_ - offset) {
+    return false;
+  }
+  for (int i = 0; i < num_segments; i++) {
+    page_size += p[kPageHeaderSize + i];
+  }
+  if (page_size > size_ - offset) {
+    return false;
+  }
+  page->offset = offset;
+  page->size = page_size;
+  page->granule_position = ReadInt64(p + 6);
+  return true;
+}
+
+bool OggOpusDecoder::Init() {
+  // Scan all the pages of the first logical stream, resynchronizing on the
+  // capture pattern after damaged data.
+  uint32_t serial_number = 0;
+  size_t offset = 0;
+  while (offset < size_) {
+    Page page;
+    if (!ParsePage(offset, &page)) {
+      const void* next = memmem(data_ + offset + 1, size_ - offset - 1,
+                                "OggS", 4);
+      if (next == nullptr) {
+        break;
+      }
+      offset = static_cast<const unsigned char*>(next) - data_;
+      continue;
+    }
+    const uint32_t page_serial_number = ReadUint32(data_ + offset + 14);
+    if (pages_.empty()) {
+      serial_number = page_serial_number;
+    }
+    if (page_serial_number == serial_number) {
+      pages_.push_back(page);
+    }
+    offset += page.size;
+  }
+  if (pages_.empty()) {
+    return false;
+  }
+  ogg_stream_reset_serialno(&stream_, serial_number);
+
+  // The ID and comment headers are the first two packets, the audio data
+  // starts on the next page.
+  int num_header_packets = 0;
+  while (num_header_packets < 2) {
+    if (!FeedPage()) {
+      return false;
+    }
+    for (const ogg_packet& packet : packets_) {
+      if (num_header_packets == 0 &&
+          !opus_header_parse(packet.packet, packet.bytes, &header_)) {
+        return false;
+      }
+      num_header_packets++;
+    }
+  }
+  first_audio_page_ = next_page_;
+
+  int error_code;
+  decoder_.reset(opus_multistream_decoder_create(
+      kSampleRateHz, header_.channels, header_.nb_streams, header_.nb_coupled,
+      header_.stream_map, &error_code));
+  if (decoder_ == nullptr) {
+    return false;
+  }
+  if (header_.gain != 0) {
+    opus_multistream_decoder_ctl(decoder_.get(), OPUS_SET_GAIN(header_.gain));
+  }
+  pcm_.resize(kMaxFrameSize * header_.channels);
+
+  // Index the pages completing a packet. Granule positions must increase,
+  // out of order pages of a damaged stream are left out of the index.
+  for (int i = first_audio_page_; i < static_cast<int>(pages_.size()); i++) {
+    const int64_t granule_position = pages_[i].granule_position;
+    if (granule_position >= 0 &&
+        (index_.empty() ||
+         granule_position >= pages_[index_.back()].granule_position)) {
+      index_.push_back(i);
+    }
+  }
+  if (!index_.empty()) {
+    end_granule_position_ = pages_[index_.back()].granule_position;
+  }
+  num_samples_ = std::max<int64_t>(0, end_granule_position_ - header_.preskip);
+
+  return Seek(0);
+}
+
+bool OggOpusDecoder::Seek(int64_t sample) {
+  if (sample < 0 || sample > num_samples_) {
+    return false;
+  }
+  const int64_t target = sample + header_.preskip;
+
+  // Find the last page ending before the pre-roll, decoding starts on the
+  // page following it.
+  auto it = std::upper_bound(
+      index_.begin(), index_.end(), target - kSeekPreRoll,
+      [this](int64_t granule_position, int page) {
+        return granule_position < pages_[page].granule_position;
+      });
+  if (it == index_.begin()) {
+    next_page_ = first_audio_page_;
+    packet_granule_position_ = 0;
+  } else {
+    next_page_ = *(it - 1) + 1;
+    packet_granule_position_ = -1;
+  }
+
+  ogg_stream_reset(&stream_);
+  opus_multistream_decoder_ctl(decoder_.get(), OPUS_RESET_STATE);
+  packets_.clear();
+  next_packet_ = 0;
+  pcm_offset_ = 0;
+  pcm_count_ = 0;
+  discard_until_ = target;
+  position_ = sample;
+  return true;
+}
+
+bool OggOpusDecoder::FeedPage() {
+  if (next_page_ >= static_cast<int>(pages_.size())) {
+    return false;
+  }
+  const Page& page = pages_[next_page_++];
+  ogg_page og;
+  og.header = const_cast<unsigned char*>(data_ + page.offset);
+  og.header_len = kPageHeaderSize + og.header[26];
+  og.body = og.header + og.header_len;
+  og.body_len = page.size - og.header_len;
+  ogg_stream_pagein(&stream_, &og);
+
+  // Packets point into the stream buffer, valid until the next page is fed.
+  packets_.clear();
+  next_packet_ = 0;
+  int64_t duration = 0;
+  ogg_packet packet;
+  int result;
+  while ((result = ogg_stream_packetout(&stream_, &packet)) != 0) {
+    if (result < 0) {
+      continue;  // Hole in the data, the partial packet is dropped.
+    }
+    packets_.push_back(packet);
+    const int num_samples =
+        opus_packet_get_nb_samples(packet.packet, packet.bytes, kSampleRateHz);
+    duration += std::max(num_samples, 0);
+  }
+
+  // After a seek, the granule position of the page locates its packets.
+  if (packet_granule_position_ < 0 && page.granule_position >= 0) {
+    packet_granule_position_ = page.granule_position - duration;
+  }
+  return true;
+}
+
+int OggOpusDecoder::DecodePacket() {
+  while (next_packet_ >= packets_.size()) {
+    if (!FeedPage()) {
+      return 0;
+    }
+  }
+  const ogg_packet& packet = packets_[next_packet_++];
+  const int num_samples = opus_multistream_decode(
+      decoder_.get(), packet.packet, packet.bytes, pcm_.data(), kMaxFrameSize,
+      0 /* decode_fec */);
+  if (num_samples < 0) {
+    return -1;
+  }
+
+  // Drop the samples before the pre-skip or seek target, and after the
+  // end of the stream.
+  const int64_t start = packet_granule_position_;
+  packet_granule_position_ += num_samples;
+  const int64_t begin = std::min<int64_t>(
+      std::max<int64_t>(discard_until_ - start, 0), num_samples);
+  const int64_t end = std::max<int64_t>(
+      std::min<int64_t>(end_granule_position_ - start, num_samples), begin);
+  pcm_offset_ = begin;
+  pcm_count_ = end - begin;
+  return 1;
+}
+
+int OggOpusDecoder::Decode(int16_t* pcm, int max_samples) {
+  const int num_channels = header_.channels;
+  int decoded = 0;
+  while (decoded < max_samples) {
+    if (pcm_count_ == 0) {
+      const int result = DecodePacket();
+      if (result < 0) {
+        return decoded > 0 ? decoded : -1;
+      }
+      if (result == 0) {
+        break;
+      }
+      continue;
+    }
+    const int n = std::min(pcm_count_, max_samples - decoded);
+    memcpy(pcm + decoded * num_channels,
+           pcm_.data() + pcm_offset_ * num_channels,
+           n * num_channels * sizeof(int16_t));
+    pcm_offset_ += n;
+    pcm_count_ -= n;
+    decoded += n;
+  }
+  position_ += decoded;
+  return decoded;
+}
+
+}  // namespace audio_util
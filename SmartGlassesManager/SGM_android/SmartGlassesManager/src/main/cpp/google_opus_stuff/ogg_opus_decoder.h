@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 TeamOpenSmartGlasses
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUDIO_UTIL_OGG_OPUS_DECODER_H_
+#define AUDIO_UTIL_OGG_OPUS_DECODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "libogg/ogg.h"
+#include "libopus/opus_multistream.h"
+#include "opus_tools/opus_header.h"
+
+namespace audio_util {
+
+// Streaming decoder of Ogg Opus data held in memory, or in a mapped file.
+//
+// Pages are read in place, without copying the input. The pages of the
+// stream are scanned once on creation, to build an index of the granule
+// positions, so that seeking to a timestamp is a binary search followed by
+// the decoding of the Opus pre-roll.
+//
+// Output is always at 48 kHz, the native rate of Opus, with the pre-skip
+// removed and the last page trimmed to its granule position.
+class OggOpusDecoder {
+ public:
+  constexpr static int kSampleRateHz = 48000;
+
+  // Returns nullptr if the data is not a valid Ogg Opus stream. The data must
+  // outlive the decoder.
+  static std::unique_ptr<OggOpusDecoder> Create(const unsigned char* data,
+                                                size_t size);
+
+  // Maps the file in memory. Returns nullptr if the file cannot be mapped, or
+  // is not a valid Ogg Opus stream.
+  static std::unique_ptr<OggOpusDecoder> CreateFromFile(
+      const std::string& path);
+
+  // Decodes the given files, each on one of num_threads threads. The result
+  // of a file that failed to decode is left empty.
+  static std::vector<std::vector<int16_t>> DecodeFiles(
+      const std::vector<std::string>& paths, int num_threads);
+
+  ~OggOpusDecoder();
+
+  int num_channels() const { return header_.channels; }
+
+  // Total number of samples per channel, known from the index.
+  int64_t num_samples() const { return num_samples_; }
+
+  // Current position, in samples per channel.
+  int64_t position() const { return position_; }
+
+  // Decodes up to max_samples per channel, interleaved, into pcm. Returns the
+  // number of samples per channel decoded, 0 at the end of the stream, or -1
+  // on a decoding error.
+  int Decode(int16_t* pcm, int max_samples);
+
+  // Moves the position to the given sample. Returns false if the sample is
+  // out of the stream.
+  bool Seek(int64_t sample);
+
+ private:
+  using OpusMSUniquePtr =
+      std::unique_ptr<OpusMSDecoder, decltype(&opus_multistream_decoder_destroy)>;
+
+  // An Ogg page located in the input data.
+  struct Page {
+    size_t offset;
+    size_t size;
+    int64_t granule_position;
+  };
+
+  OggOpusDecoder(const unsigned char* data, size_t size);
+
+  // Scans the pages, parses the headers and builds the index.
+  bool Init();
+
+  // Locates the page starting at offset, returns false at the end of data.
+  bool ParsePage(size_t offset, Page* page) const;
+
+  // Feeds the next page to the Ogg stream, and queues its packets. Returns
+  // false at the end of the stream.
+  bool FeedPage();
+
+  // Decodes the next queued packet, refilling the queue as needed. Returns
+  // the number of samples decoded, 0 at the end of stream, -1 on error.
+  int DecodePacket();
+
+  const unsigned char* data_;
+  size_t size_;
+
+  // Set when the data is a mapped file, to unmap on destruction.
+  void* mapping_;
+
+  OpusHeader header_;
+  OpusMSUniquePtr decoder_;
+
+  // All the pages of the stream, and the ones following the headers that
+  // complete a packet, ordered by granule position.
+  std::vector<Page> pages_;
+  std::vector<int> index_;
+  int first_audio_page_;
+  int next_page_;
+
+  int64_t num_samples_;
+  int64_t end_granule_position_;
+
+  // Queue of packets of the current page.
+  std::vector<ogg_packet> packets_;
+  size_t next_packet_;
+
+  // Granule position of the next packet to decode, -1 until known.
+  int64_t packet_granule_position_;
+
+  // Decoded samples of the current packet, not yet returned.
+  std::vector<int16_t> pcm_;
+  int pcm_offset_;
+  int pcm_count_;
+
+  // Samples before this granule position are dropped (pre-skip, seeking).
+  int64_t discard_until_;
+  int64_t position_;
+
+  ogg_stream_state stream_;
+};
+
+}  // namespace audio_util
+
+#endif  // AUDIO_UTIL_OGG_OPUS_DECODER_H_
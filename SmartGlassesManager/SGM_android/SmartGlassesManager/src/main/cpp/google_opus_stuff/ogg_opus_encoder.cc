@@ -18,6 +18,8 @@
 
 #include <cassert>
 #include <endian.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <cstdint>
@@ -43,6 +43,15 @@
  *   any supported samplerates (8 to 48 KHz). Two frames duration are
  *   available 7.5ms and 10ms.
  *
+ * - Non-standard ultra low delay frame durations of 2.5ms and 5ms can be
+ *   built, by defining `LC3_NONSTANDARD_DT` for the library and its users.
+ *   They follow the principles of LC3plus, but use their own windows and
+ *   bands, and are NOT compatible with LC3plus : both ends of the link
+ *   must run this library, built with the option. The long term
+ *   postfilter and the attack detection are not run on these durations,
+ *   neither the temporal noise shaping on 2.5ms frames. Without the
+ *   option, these durations are rejected as any other bad parameter.
+ *
  *
  * --- About 44.1 KHz samplerate ---
  *
@@ -126,6 +135,7 @@ extern "C" {
  * Limitations
  * - On the bitrate, in bps, of a stream
  * - On the size of the frames in bytes
+ * - On the number of streams of a simulcast encoding
  */
 
 #define LC3_MIN_BITRATE    16000
@@ -134,16 +144,31 @@ extern "C" {
 #define LC3_MIN_FRAME_BYTES   20
 #define LC3_MAX_FRAME_BYTES  400
 
+#define LC3_MAX_SIMULCAST  __LC3_MAX_SIMULCAST
+
 
 /**
  * Parameters check
  *   LC3_CHECK_DT_US(us)  True when frame duration in us is suitable
  *   LC3_CHECK_SR_HZ(sr)  True when samplerate in Hz is suitable
+ *
+ * The non-standard durations 2500 and 5000 are suitable only when
+ * `LC3_NONSTANDARD_DT` is defined.
  */
 
+#ifdef LC3_NONSTANDARD_DT
+
+#define LC3_CHECK_DT_US(us) \
+    ( ((us) == 2500) || ((us) ==  5000) || \
+      ((us) == 7500) || ((us) == 10000)    )
+
+#else /* LC3_NONSTANDARD_DT */
+
 #define LC3_CHECK_DT_US(us) \
     ( ((us) == 7500) || ((us) == 10000) )
 
+#endif /* LC3_NONSTANDARD_DT */
+
 #define LC3_CHECK_SR_HZ(sr) \
     ( ((sr) ==  8000) || ((sr) == 16000) || ((sr) == 24000) || \
       ((sr) == 32000) || ((sr) == 48000)                       )
@@ -166,6 +191,43 @@ enum lc3_pcm_format {
 };
 
 
+/**
+ * Encoder complexity
+ *   FULL     Complete analysis of the frames, as the reference encoder
+ *   MEDIUM   The pitch analysis of the long term postfilter is skipped,
+ *            and the global gain is only adjusted to fit the frame
+ *   LOW      The temporal noise shaping is also disabled
+ *
+ * The lower levels trade quality for less computation on each frame,
+ * the bitstream remains conformant, and decodable by any LC3 decoder.
+ */
+
+enum lc3_complexity {
+    LC3_COMPLEXITY_FULL,
+    LC3_COMPLEXITY_MEDIUM,
+    LC3_COMPLEXITY_LOW,
+};
+
+
+/**
+ * Decoder mode
+ *   PLAYBACK  Complete synthesis, as the reference decoder
+ *   ASR       Reduced synthesis, for speech recognition, or any processing
+ *             of the signal not intended for listening :
+ *             - The long term postfilter is not applied
+ *             - The spectrum is synthesized up to the bandwidth signaled
+ *               in the frame, and cleared above
+ *             - The float output is scaled, without clipping
+ *
+ * The parsing of the bitstream is the same in both modes.
+ */
+
+enum lc3_decoder_mode {
+    LC3_DECODER_MODE_PLAYBACK,
+    LC3_DECODER_MODE_ASR,
+};
+
+
 /**
  * Handle
  */
@@ -174,6 +236,17 @@ typedef struct lc3_encoder *lc3_encoder_t;
 typedef struct lc3_decoder *lc3_decoder_t;
 
 
+/**
+ * Spectral processing of the encoder
+ * ctx             Context given on registration
+ * x               MDCT coefficients of the frame, modified in place
+ * e               Energy estimation per band of the coefficients
+ * return          True when the coefficients have been modified
+ */
+
+typedef bool (*lc3_spectrum_hook_t)(void *ctx, float *x, const float *e);
+
+
 /**
  * Static memory of encoder context
  *
@@ -250,6 +323,32 @@ unsigned lc3_encoder_size(int dt_us, int sr_hz);
 lc3_encoder_t lc3_setup_encoder(
     int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
 
+/**
+ * Set the complexity of the encoder
+ * encoder         Handle of the encoder
+ * complexity      Level of complexity, `LC3_COMPLEXITY_FULL` on setup
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The level can be changed between frames, to follow the battery level
+ * for instance.
+ */
+int lc3_encoder_set_complexity(
+    lc3_encoder_t encoder, enum lc3_complexity complexity);
+
+/**
+ * Set a spectral processing of the encoder
+ * encoder         Handle of the encoder
+ * hook, ctx       Processing of each frame and its context, NULL to remove
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The hook is run on the MDCT coefficients, after the energy estimation
+ * and before the spectral shaping. When the coefficients are modified,
+ * the energy estimation is run again, and the bandwidth detection
+ * follows the modified spectrum. See `lc3_denoise.h`.
+ */
+int lc3_encoder_set_spectrum_hook(
+    lc3_encoder_t encoder, lc3_spectrum_hook_t hook, void *ctx);
+
 /**
  * Encode a frame
  * encoder         Handle of the encoder
@@ -262,6 +361,28 @@ lc3_encoder_t lc3_setup_encoder(
 int lc3_encode(lc3_encoder_t encoder, enum lc3_pcm_format fmt,
     const void *pcm, int stride, int nbytes, void *out);
 
+/**
+ * Encode a frame at different sizes
+ * encoder         Handle of the encoder
+ * fmt             PCM input format
+ * pcm, stride     Input PCM samples, and count between two consecutives
+ * nstreams        Number of streams (1 to `LC3_MAX_SIMULCAST`)
+ * nbytes          Target size, in bytes, of the frame of each stream
+ * out             Output buffer, receiving the frames of the streams
+ *                 one after the other, of the sum of `nbytes` size
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The analysis that does not depend on the size of the frames (pitch,
+ * MDCT, energy and bandwidth detection) is run once, for all the streams.
+ * The state of the analysis depending on the size of the frames is kept
+ * per stream, so each stream is coded as by its own encoder. The stream
+ * `0` shares its state with `lc3_encode()`, and the number of streams
+ * should not change during the encoding session.
+ */
+int lc3_encode_simulcast(lc3_encoder_t encoder,
+    enum lc3_pcm_format fmt, const void *pcm, int stride,
+    int nstreams, const int *nbytes, void *out);
+
 /**
  * Return size needed for an decoder
  * dt_us           Frame duration in us, 7500 or 10000
@@ -290,6 +411,14 @@ unsigned lc3_decoder_size(int dt_us, int sr_hz);
 lc3_decoder_t lc3_setup_decoder(
     int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
 
+/**
+ * Set the mode of the decoder
+ * decoder         Handle of the decoder
+ * mode            Mode of the decoder, `LC3_DECODER_MODE_PLAYBACK` on setup
+ * return          0: On success  -1: Wrong parameters
+ */
+int lc3_decoder_set_mode(lc3_decoder_t decoder, enum lc3_decoder_mode mode);
+
 /**
  * Decode a frame
  * decoder         Handle of the decoder
@@ -301,6 +430,55 @@ lc3_decoder_t lc3_setup_decoder(
 int lc3_decode(lc3_decoder_t decoder, const void *in, int nbytes,
     enum lc3_pcm_format fmt, void *pcm, int stride);
 
+/**
+ * Return the number of bands of the energies decoded
+ * dt_us           Frame duration in us, 7500 or 10000
+ * sr_hz           Samplerate of the stream in Hz, 8000 to 48000
+ * return          Number of bands (64 at most), -1 on bad parameters
+ */
+int lc3_energy_bands(int dt_us, int sr_hz);
+
+/**
+ * Decode the energies of the bands of a frame, without synthesis
+ * decoder         Handle of the decoder
+ * in, nbytes      Input bitstream, and size in bytes, NULL performs PLC
+ * e               Output energies of the bands, in dB, `lc3_energy_bands()`
+ *                 values with a floor at -100 dB
+ * return          0: On success  1: PLC operated  -1: Wrong parameters
+ *
+ * The energies are the means of the squared MDCT coefficients, on the
+ * spectrum as input of the inverse transform, and in bands of increasing
+ * width with frequency. They are suitable as log-mel like features, for
+ * voice activity detection or keyword spotting, at the cost of the frame
+ * parsing only : the inverse MDCT, the postfilter and the PCM conversion
+ * are skipped.
+ *
+ * The time domain history of the decoder is not updated, the output of
+ * a following `lc3_decode()` is not continuous.
+ */
+int lc3_decode_energies(lc3_decoder_t decoder,
+    const void *in, int nbytes, float *e);
+
+/**
+ * Estimate the level of a frame, without decoding it
+ * dt_us, sr_hz    Frame duration in us and samplerate in Hz of the stream
+ * in, nbytes      Input bitstream, and size in bytes
+ * level           Return the estimated level, in dB relative to full scale
+ * pitch           Return true when a pitch is signalled (voiced frame)
+ * return          0: On success  -1: Wrong parameters or invalid frame
+ *
+ * Only the side data at the head of the frame is read : the bandwidth,
+ * the global gain, the noise factor and the SNS envelope. The cost is
+ * a small fraction of `lc3_decode()`, and no decoder state is needed.
+ *
+ * The coded coefficients are assumed of even magnitude, which holds
+ * for noise-like frames within a few dB. The level of tonal or voiced
+ * frames, concentrated on few coefficients, is underestimated by up
+ * to 10 to 15 dB, the pitch indication helps to classify them.
+ */
+int lc3_frame_level(int dt_us, int sr_hz,
+    const void *in, int nbytes, float *level, bool *pitch);
+
 
 #ifdef __cplusplus
 }
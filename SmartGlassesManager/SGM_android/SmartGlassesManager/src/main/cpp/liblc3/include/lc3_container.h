@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Seekable container
+ *
+ * Stores a stream of LC3 frames with its configuration, and an index
+ * allowing random access in constant time. All the fields are little
+ * endian.
+ *
+ *   Header (32 bytes)
+ *
+ *     | "LC3F" | Version | - | Block frames | Frame duration (us)        |
+ *     | Samplerate (Hz)  | Nominal size of frames (0: variable)  | -   |
+ *     | Timestamp of the first frame (us, 64 bits)                      |
+ *
+ *   Blocks, of `block frames` frames (the last one can be shorter)
+ *
+ *     | "LC3B" | Number of frames (16 bits) | Size of data (16 bits)    |
+ *     | Timestamp of the first frame of the block (us, 64 bits)         |
+ *     | End offset of each frame in the data (16 bits each)             |
+ *     | Data : Concatenation of the frames                              |
+ *
+ *   Index, written on completion
+ *
+ *     | Offset of each block (64 bits each)                             |
+ *     | Offset of the index (64 bits) | Number of blocks | "LC3I"       |
+ *
+ * Frames are contiguous in time, a lost frame is recorded as an empty
+ * frame, so that the frame `n` is located in the block `n / block frames`.
+ * When the index is missing (interrupted recording), the reader rebuilds
+ * it by walking through the blocks.
+ */
+
+#ifndef __LC3_CONTAINER_H
+#define __LC3_CONTAINER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+
+/**
+ * Handles
+ */
+
+typedef struct lc3_writer *lc3_writer_t;
+typedef struct lc3_reader *lc3_reader_t;
+
+
+/**
+ * Stream description
+ * dt_us, sr_hz    Frame duration in us, and samplerate in Hz
+ * nbytes          Nominal size of the frames, 0 when variable
+ * start_us        Timestamp of the first frame, in us
+ * nframes         Number of frames (reader only)
+ */
+
+struct lc3_container_info {
+    int dt_us, sr_hz;
+    int nbytes;
+    int64_t start_us;
+    int64_t nframes;
+};
+
+
+/**
+ * Create a container file, and its writer
+ * path            Path of the file, truncated when it exists
+ * info            Stream description, `nframes` is ignored
+ * return          The writer as an handle, NULL on error
+ */
+lc3_writer_t lc3_writer_open(
+    const char *path, const struct lc3_container_info *info);
+
+/**
+ * Append a frame
+ * writer          Handle of the writer
+ * frame, nbytes   The frame, and its size in bytes. NULL or 0 marks
+ *                 a lost frame
+ * return          0: On success  -1: Wrong parameters or I/O error
+ */
+int lc3_writer_put(lc3_writer_t writer, const void *frame, int nbytes);
+
+/**
+ * Complete the file with its index, and destroy the writer
+ * writer          Handle of the writer, can be NULL
+ * return          0: On success  -1: I/O error
+ */
+int lc3_writer_close(lc3_writer_t writer);
+
+/**
+ * Open a container file
+ * path            Path of the file
+ * return          The reader as an handle, NULL on error
+ */
+lc3_reader_t lc3_reader_open(const char *path);
+
+/**
+ * Close a container file
+ * reader          Handle of the reader, can be NULL
+ */
+void lc3_reader_close(lc3_reader_t reader);
+
+/**
+ * Return the description of the stream
+ * reader          Handle of the reader
+ * info            Return the description
+ */
+void lc3_reader_info(lc3_reader_t reader, struct lc3_container_info *info);
+
+/**
+ * Locate a frame
+ * reader          Handle of the reader
+ * n               Number of the frame, from 0
+ * frame           Return a pointer to the frame, in the mapping of the file
+ * return          Size of the frame, 0 when lost, -1 when out of range
+ */
+int lc3_reader_get(lc3_reader_t reader, int64_t n, const void **frame);
+
+/**
+ * Return the frame at a given time
+ * reader          Handle of the reader
+ * t_us            Timestamp in us
+ * return          Number of the frame covering `t_us`, clamped
+ *                 to the range of the stream
+ */
+int64_t lc3_reader_seek(lc3_reader_t reader, int64_t t_us);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LC3_CONTAINER_H */
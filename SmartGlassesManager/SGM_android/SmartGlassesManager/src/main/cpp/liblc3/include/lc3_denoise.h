@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Noise suppression in the MDCT domain of the encoder
+ *
+ * The suppression gains of the rnnoise network are applied to the MDCT
+ * spectrum of the encoder, before the spectral shaping. No other transform
+ * is run than the one of the encoder :
+ *
+ *   1. The energy estimation of the LC3 bands gives the power spectrum,
+ *      at the 50 Hz resolution of the network, on 10 ms of signal.
+ *      Shorter frames are accumulated, and share the gains.
+ *   2. The pitch and its correlation are taken from the analysis of the
+ *      long term postfilter. They are known for 7.5 and 10 ms frames, at
+ *      the `LC3_COMPLEXITY_FULL` level. Otherwise, the network runs as on
+ *      unvoiced frames, and suppresses more.
+ *   3. The gains of the bands are interpolated and applied to the MDCT
+ *      coefficients. The pitch filter of rnnoise, that needs the spectrum
+ *      of the delayed signal, is not applied.
+ *
+ * The network is the default rnnoise model. The state is allocated on
+ * creation, the encoding does not rely on any dynamic memory allocation.
+ */
+
+#ifndef __LC3_DENOISE_H
+#define __LC3_DENOISE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lc3.h>
+
+
+/**
+ * Handle
+ */
+
+typedef struct lc3_denoiser *lc3_denoiser_t;
+
+
+/**
+ * Create a denoiser, on the frames of an encoder
+ * encoder         Handle of the encoder
+ * return          The denoiser as an handle, NULL on bad parameters
+ *
+ * The frames encoded from now are denoised. The denoiser replaces any
+ * spectral processing set on the encoder.
+ */
+lc3_denoiser_t lc3_denoiser_create(lc3_encoder_t encoder);
+
+/**
+ * Destroy a denoiser, the encoder is back to plain encoding
+ * denoiser        Handle of the denoiser, can be NULL
+ *
+ * The denoiser is to be destroyed before its encoder.
+ */
+void lc3_denoiser_destroy(lc3_denoiser_t denoiser);
+
+/**
+ * Return the voice probability of the last frame
+ * denoiser        Handle of the denoiser
+ * return          Probability from 0 to 1, -1 on bad parameters
+ */
+float lc3_denoiser_vad(lc3_denoiser_t denoiser);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LC3_DENOISE_H */
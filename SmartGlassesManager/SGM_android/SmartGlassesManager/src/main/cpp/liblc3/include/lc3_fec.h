@@ -0,0 +1,133 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+/**
+ * LC3 - Forward error correction, by redundant low rate frames
+ *
+ * Each packet carries the frame, and a low rate encoding of the frame
+ * sent `delay` packets before :
+ *
+ *     | Frame n (`nbytes`) | Redundant frame n-delay (`nbytes_fec`) |
+ *
+ * The redundant frames are coded by the same encoder, as a second stream
+ * of `lc3_encode_simulcast()`, so that the analysis is shared.
+ *
+ * The decoder outputs the frames with a delay of `delay` frames, waiting
+ * for the packet carrying the redundant copy. A lost frame is decoded
+ * from its redundant copy, and concealed only when both packets are lost.
+ * A burst of lost packets is fully recovered up to `delay` packets, and
+ * `delay` frames are recovered from a longer burst.
+ */
+
+#ifndef __LC3_FEC_H
+#define __LC3_FEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lc3.h>
+
+
+/**
+ * Maximum distance between a frame and its redundant copy
+ */
+
+#define LC3_FEC_MAX_DELAY  4
+
+
+/**
+ * Encoder and decoder states
+ */
+
+typedef struct lc3_fec_encoder {
+    int nbytes, nbytes_fec;
+    int delay, idx;
+    uint8_t fec[LC3_FEC_MAX_DELAY][LC3_MAX_FRAME_BYTES];
+} lc3_fec_encoder_t;
+
+typedef struct lc3_fec_decoder {
+    int nbytes, nbytes_fec;
+    int delay, idx, nframes;
+    bool received[LC3_FEC_MAX_DELAY];
+    uint8_t frame[LC3_FEC_MAX_DELAY][LC3_MAX_FRAME_BYTES];
+} lc3_fec_decoder_t;
+
+
+/**
+ * Setup the encoding of packets
+ * fec             FEC encoder state
+ * nbytes          Size of the frames (20 to 400)
+ * nbytes_fec      Size of the redundant frames (20 to 400)
+ * delay           Distance in frames of the redundant copy (1 to 4)
+ * return          0: On success  -1: Wrong parameters
+ */
+int lc3_fec_setup_encoder(lc3_fec_encoder_t *fec,
+    int nbytes, int nbytes_fec, int delay);
+
+/**
+ * Encode a packet
+ * fec             FEC encoder state
+ * encoder         Handle of the encoder
+ * fmt             PCM input format
+ * pcm, stride     Input PCM samples, and count between two consecutives
+ * out             Output packet, of `nbytes + nbytes_fec` size
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The simulcast streams `0` and `1` of the encoder are used.
+ */
+int lc3_fec_encode(lc3_fec_encoder_t *fec,
+    lc3_encoder_t encoder, enum lc3_pcm_format fmt,
+    const void *pcm, int stride, void *out);
+
+/**
+ * Setup the decoding of packets
+ * fec             FEC decoder state
+ * nbytes          Size of the frames (20 to 400)
+ * nbytes_fec      Size of the redundant frames (20 to 400)
+ * delay           Distance in frames of the redundant copy (1 to 4)
+ * return          0: On success  -1: Wrong parameters
+ */
+int lc3_fec_setup_decoder(lc3_fec_decoder_t *fec,
+    int nbytes, int nbytes_fec, int delay);
+
+/**
+ * Decode the frame sent `delay` packets before
+ * fec             FEC decoder state
+ * decoder         Handle of the decoder
+ * in              Input packet of `nbytes + nbytes_fec` size, NULL if lost
+ * fmt             PCM output format
+ * pcm, stride     Output PCM samples, and count between two consecutives
+ * return          0: Frame decoded  1: PLC operated
+ *                 2: Recovered from the redundant frame  -1: Wrong parameters
+ *
+ * The output is delayed by `delay` packets, the first calls output
+ * silence. At the end of the stream, `delay` calls with a NULL packet
+ * drain the last frames.
+ */
+int lc3_fec_decode(lc3_fec_decoder_t *fec,
+    lc3_decoder_t decoder, const void *in,
+    enum lc3_pcm_format fmt, void *pcm, int stride);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LC3_FEC_H */
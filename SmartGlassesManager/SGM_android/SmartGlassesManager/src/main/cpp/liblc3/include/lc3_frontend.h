@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - PCM Front end
+ *
+ * The encoder operates on exact frames, at one of the samplerates
+ * supported by the codec. The front end accepts PCM buffers of any size,
+ * interleaved with any number of channels, and at any samplerate :
+ *
+ *   1. The channels are downmixed to mono
+ *   2. The stream is resampled to the samplerate of the encoder,
+ *      using a streaming polyphase filter
+ *   3. Frames are cut and encoded as soon as they are complete,
+ *      the remaining samples are kept for the next call.
+ *
+ * All the memory is allocated on creation, the encoding procedure
+ * does not rely on any dynamic memory allocation.
+ */
+
+#ifndef __LC3_FRONTEND_H
+#define __LC3_FRONTEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lc3.h>
+
+
+/**
+ * Handle
+ */
+
+typedef struct lc3_frontend *lc3_frontend_t;
+
+
+/**
+ * Create a front end, and its encoder
+ * dt_us           Frame duration in us, 7500 or 10000
+ * sr_hz           Samplerate of the encoder, in Hz
+ * sr_in_hz        Samplerate of the PCM input, any value in Hz
+ * nch             Number of interleaved channels of the PCM input
+ * return          The front end as an handle, NULL on bad parameters
+ */
+lc3_frontend_t lc3_frontend_create(
+    int dt_us, int sr_hz, int sr_in_hz, int nch);
+
+/**
+ * Destroy a front end
+ * frontend        Handle of the front end, can be NULL
+ */
+void lc3_frontend_destroy(lc3_frontend_t frontend);
+
+/**
+ * Return the number of channels of the PCM input
+ * frontend        Handle of the front end
+ * return          Number of interleaved channels, -1 on bad parameters
+ */
+int lc3_frontend_channels(lc3_frontend_t frontend);
+
+/**
+ * Return the maximum number of frames produced by an encoding call
+ * frontend        Handle of the front end
+ * ns              Number of PCM samples per channel, given as input
+ * return          Upper bound of frames, -1 on bad parameters
+ */
+int lc3_frontend_max_frames(lc3_frontend_t frontend, int ns);
+
+/**
+ * Encode PCM samples
+ * frontend        Handle of the front end
+ * fmt             PCM input format
+ * pcm, ns         Interleaved PCM samples, and count per channel
+ * nbytes          Target size, in bytes, of the frames (20 to 400)
+ * out             Output buffer, at least `lc3_frontend_max_frames()`
+ *                 times `nbytes` size
+ * return          Number of frames encoded, -1 on bad parameters
+ *
+ * The frames are written consecutively, the frame `n` is located
+ * at `out + n * nbytes`.
+ */
+int lc3_frontend_encode(lc3_frontend_t frontend, enum lc3_pcm_format fmt,
+    const void *pcm, int ns, int nbytes, void *out);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LC3_FRONTEND_H */
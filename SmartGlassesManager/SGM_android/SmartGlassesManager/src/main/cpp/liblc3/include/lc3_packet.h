@@ -0,0 +1,157 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+/**
+ * LC3 - Packetization of frames, for BLE notifications
+ *
+ * As many frames as fit in the payload of a notification (ATT MTU - 3)
+ * are packed behind a 2 bytes header :
+ *
+ *     | Sequence (8 bits) | V (1 bit) | Count (7 bits) | Frames ... |
+ *
+ * - The sequence is the number, modulo 256, of the first frame of the
+ *   packet. Frames are numbered, not packets, so that the number of lost
+ *   frames is known exactly, whatever the number of frames per packet.
+ *
+ * - When `V` is set, each frame is prefixed by its size in bytes, on one
+ *   byte (as produced by the rate control). Otherwise the frames have
+ *   the same size, deduced from the size of the packet.
+ *
+ * Both directions are zero-copy : frames are encoded in place in the
+ * packet buffer, and are decoded from the received packet.
+ *
+ * The depacketizer emits an explicit loss marker, an empty frame, for
+ * each missing frame, to be fed as is to `lc3_decode()` (NULL frame).
+ * Packets late or duplicated, behind the frames already emitted,
+ * are dropped. The sequence distinguishes 127 frames ahead from 128
+ * frames behind : after a longer outage, the depacketizer resynchronizes
+ * on the stream when a few packets in a row look late.
+ */
+
+#ifndef __LC3_PACKET_H
+#define __LC3_PACKET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lc3.h>
+
+
+/**
+ * Size of the header, maximum frames per packet, and maximum size
+ * of frames when prefixed by their size
+ */
+
+#define LC3_PACKET_HEADER_BYTES      2
+#define LC3_PACKET_MAX_FRAMES      127
+#define LC3_PACKET_MAX_FRAME_BYTES 255
+
+
+/**
+ * Packetizer and depacketizer states
+ */
+
+typedef struct lc3_packetizer {
+    int size;
+    bool vsize;
+    unsigned seq;
+
+    uint8_t *packet;
+    int count, nbytes, len;
+} lc3_packetizer_t;
+
+typedef struct lc3_depacketizer {
+    bool started;
+    unsigned seq;
+    int nlost, ndrops;
+
+    const uint8_t *p;
+    int count, nbytes;
+    bool vsize;
+} lc3_depacketizer_t;
+
+
+/**
+ * Setup the packetizer
+ * pk              Packetizer state
+ * size            Size of the packets, the payload of notifications
+ * vsize           True when the size of frames can vary
+ * return          0: On success  -1: Wrong parameters
+ */
+int lc3_packetizer_setup(lc3_packetizer_t *pk, int size, bool vsize);
+
+/**
+ * Start a packet
+ * pk              Packetizer state
+ * packet          Buffer of the packet, of the size given on setup
+ */
+void lc3_packetizer_begin(lc3_packetizer_t *pk, void *packet);
+
+/**
+ * Add a frame to the packet
+ * pk              Packetizer state
+ * nbytes          Size of the frame in bytes
+ * return          Location to write the frame, in the buffer of the packet,
+ *                 NULL when it does not fit or on wrong size
+ *
+ * Without variable size, the size of the frames shall be the same
+ * within a packet.
+ */
+void *lc3_packetizer_add(lc3_packetizer_t *pk, int nbytes);
+
+/**
+ * Complete the packet
+ * pk              Packetizer state
+ * return          Size of the packet in bytes, 0 when empty
+ */
+int lc3_packetizer_end(lc3_packetizer_t *pk);
+
+/**
+ * Setup the depacketizer
+ * dp              Depacketizer state
+ * return          0: On success  -1: Wrong parameters
+ */
+int lc3_depacketizer_setup(lc3_depacketizer_t *dp);
+
+/**
+ * Put a received packet
+ * dp              Depacketizer state
+ * packet, size    The packet, and its size in bytes
+ * return          Number of frames lost before the packet,
+ *                 -1 when the packet is malformed, late or duplicated
+ *
+ * The packet buffer shall stay valid, until all its frames are taken.
+ */
+int lc3_depacketizer_put(lc3_depacketizer_t *dp, const void *packet, int size);
+
+/**
+ * Take the next frame
+ * dp              Depacketizer state
+ * frame           Return the frame, in the packet buffer, NULL when lost
+ * return          Size of the frame, 0 when lost, -1 when no frames left
+ */
+int lc3_depacketizer_get(lc3_depacketizer_t *dp, const void **frame);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LC3_PACKET_H */
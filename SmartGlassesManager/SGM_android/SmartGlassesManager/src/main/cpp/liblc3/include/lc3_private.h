@@ -34,21 +34,24 @@
     ( (dt_us * sr_hz) / 1000 / 1000 )
 
 #define __LC3_ND(dt_us, sr_hz) \
-    ( (dt_us) == 7500 ? 23 * __LC3_NS(dt_us, sr_hz) / 30 \
-                      :  5 * __LC3_NS(dt_us, sr_hz) /  8 )
+    ( (dt_us) == 10000 ?  5 * __LC3_NS(dt_us, sr_hz) /  8 : \
+      (dt_us) ==  7500 ? 23 * __LC3_NS(dt_us, sr_hz) / 30 : \
+                          3 * __LC3_NS(dt_us, sr_hz) /  5 )
 
 #define __LC3_NT(sr_hz) \
     ( (5 * sr_hz) / 4000 )
 
 #define __LC3_NH(dt_us, sr_hz) \
-    ( ((3 - ((dt_us) >= 10000)) + 1) * __LC3_NS(dt_us, sr_hz) )
+    ( (2 + 18000 / (dt_us)) * __LC3_NS(dt_us, sr_hz) )
 
 
 /**
- * Frame duration 7.5ms or 10ms
+ * Frame duration 2.5ms, 5ms, 7.5ms or 10ms
  */
 
 enum lc3_dt {
+    LC3_DT_2M5,
+    LC3_DT_5M,
     LC3_DT_7M5,
     LC3_DT_10M,
 
@@ -99,13 +102,19 @@ typedef struct lc3_spec_analysis {
     int nbits_spare;
 } lc3_spec_analysis_t;
 
+#define __LC3_MAX_SIMULCAST  4
+
 struct lc3_encoder {
     enum lc3_dt dt;
     enum lc3_srate sr, sr_pcm;
+    int complexity;
 
-    lc3_attdet_analysis_t attdet;
+    lc3_attdet_analysis_t attdet[__LC3_MAX_SIMULCAST];
     lc3_ltpf_analysis_t ltpf;
-    lc3_spec_analysis_t spec;
+    lc3_spec_analysis_t spec[__LC3_MAX_SIMULCAST];
+
+    bool (*spectrum_hook)(void *, float *, const float *);
+    void *spectrum_ctx;
 
     int16_t *xt;
     float *xs, *xd, s[0];
@@ -141,6 +150,7 @@ typedef struct lc3_plc_state {
 struct lc3_decoder {
     enum lc3_dt dt;
     enum lc3_srate sr, sr_pcm;
+    int mode;
 
     lc3_ltpf_synthesis_t ltpf;
     lc3_plc_state_t plc;
@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Link adaptive rate control
+ *
+ * The size of LC3 frames can be changed at any time. The rate controller
+ * selects the size of each frame, from feedback of the transport link :
+ *
+ * - The number of frames waiting to be sent (queue depth)
+ * - The number of frames sent and lost, since the last report
+ * - The measured throughput of the link
+ *
+ * The size is lowered as soon as the link congests, and raised one step
+ * at a time, only after the link has been stable long enough. The hold-off
+ * delay before raising doubles on each new congestion episode, preventing
+ * oscillations, and shortens back on each successful raise.
+ *
+ * As the size of frames varies, each frame is prefixed by a one byte
+ * header, giving its size in bytes. The sizes are thus limited to
+ * `LC3_RATECTL_MAX_FRAME_BYTES`.
+ */
+
+#ifndef __LC3_RATECTL_H
+#define __LC3_RATECTL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lc3.h>
+
+
+/**
+ * Maximum size of frames, and size of the in-band header
+ */
+
+#define LC3_RATECTL_MAX_FRAME_BYTES  255
+#define LC3_RATECTL_HEADER_BYTES       1
+
+
+/**
+ * Link feedback
+ *   queue           Number of frames waiting to be sent
+ *   sent, lost      Number of frames sent and lost since the last report
+ *   throughput      Measured throughput in bps, 0 when unknown
+ */
+
+struct lc3_ratectl_link {
+    int queue;
+    int sent, lost;
+    int throughput;
+};
+
+
+/**
+ * Rate controller state
+ */
+
+typedef struct lc3_ratectl {
+    int dt_us;
+    int min_step, max_step;
+
+    int step;
+    float loss;
+    bool congested;
+    int nframes, holdoff;
+} lc3_ratectl_t;
+
+
+/**
+ * Setup the rate controller
+ * ctl             Rate controller state
+ * dt_us           Frame duration in us, 7500 or 10000
+ * min_bytes       Minimum size of frames (20 to 255)
+ * max_bytes       Maximum size of frames (20 to 255)
+ * return          0: On success  -1: Wrong parameters
+ *
+ * The sizes selected are the ones of the table of the controller, within
+ * the minimum and maximum sizes. No size in the range is a wrong
+ * parameter. The controller starts at the smallest size selectable.
+ */
+int lc3_ratectl_setup(lc3_ratectl_t *ctl,
+    int dt_us, int min_bytes, int max_bytes);
+
+/**
+ * Report feedback of the link
+ * ctl             Rate controller state
+ * link            Feedback of the link, since the last report
+ */
+void lc3_ratectl_update(lc3_ratectl_t *ctl,
+    const struct lc3_ratectl_link *link);
+
+/**
+ * Return the size selected for the next frame
+ * ctl             Rate controller state
+ * return          Size of the frame in bytes, excluding the header
+ */
+int lc3_ratectl_nbytes(const lc3_ratectl_t *ctl);
+
+/**
+ * Encode a frame, with its in-band header
+ * ctl             Rate controller state
+ * encoder         Handle of the encoder
+ * fmt             PCM input format
+ * pcm, stride     Input PCM samples, and count between two consecutives
+ * out             Output buffer, of `LC3_RATECTL_HEADER_BYTES` plus
+ *                 `lc3_ratectl_nbytes()` size
+ * return          Size written in bytes, -1 on wrong parameters
+ */
+int lc3_ratectl_encode(lc3_ratectl_t *ctl,
+    lc3_encoder_t encoder, enum lc3_pcm_format fmt,
+    const void *pcm, int stride, void *out);
+
+/**
+ * Decode a frame, prefixed by its in-band header
+ * decoder         Handle of the decoder
+ * in, size        Input bitstream, and size available in bytes
+ * fmt             PCM output format
+ * pcm, stride     Output PCM samples, and count between two consecutives
+ * return          Size consumed in bytes, -1 on wrong or truncated frame
+ *
+ * A wrong or truncated frame is concealed, as a lost frame.
+ */
+int lc3_ratectl_decode(lc3_decoder_t decoder, const void *in, int size,
+    enum lc3_pcm_format fmt, void *pcm, int stride);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LC3_RATECTL_H */
@@ -0,0 +1,94 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+/**
+ * LC3 - Silence detection in the compressed domain
+ *
+ * Frames are classified as silence or speech from their level, estimated
+ * by `lc3_frame_level()` on the side data only. No decoder is involved,
+ * so that silent frames can be dropped or deferred before decoding.
+ *
+ * The level is compared to the noise floor of the stream :
+ *
+ * - The floor is the minimum of the level over a sliding window of
+ *   about 1.6 s, tracked on 4 sub-windows. It settles on the background
+ *   noise between words, and follows its changes.
+ *
+ * - A frame is speech when its level exceeds the floor by a margin,
+ *   lowered for voiced frames (pitch signalled), and above an absolute
+ *   threshold. The speech state is held for a hangover delay, keeping
+ *   the tails of words.
+ *
+ * Until the first sub-window completes, at the start of the stream,
+ * the frames are classified as speech.
+ *
+ * Lost or invalid frames keep the current state.
+ */
+
+#ifndef __LC3_SILENCE_H
+#define __LC3_SILENCE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lc3.h>
+
+
+/**
+ * Silence detector state
+ */
+
+#define LC3_SILENCE_NUM_WINDOWS  4
+
+typedef struct lc3_silence {
+    int dt_us, sr_hz;
+
+    float level, floor;
+    bool pitch, speech;
+    int hangover;
+
+    float win_min[LC3_SILENCE_NUM_WINDOWS], cur_min;
+    int win_idx, cur_frames;
+} lc3_silence_t;
+
+
+/**
+ * Setup the silence detector
+ * det             Silence detector state
+ * dt_us           Frame duration in us, 7500 or 10000
+ * sr_hz           Samplerate in Hz, 8000, 16000, 24000, 32000 or 48000
+ * return          0: On success  -1: Wrong parameters
+ */
+int lc3_silence_setup(lc3_silence_t *det, int dt_us, int sr_hz);
+
+/**
+ * Classify a frame
+ * det             Silence detector state
+ * in, nbytes      Input bitstream, and size in bytes, NULL for a lost frame
+ * return          1: Silence  0: Speech
+ */
+int lc3_silence_detect(lc3_silence_t *det, const void *in, int nbytes);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LC3_SILENCE_H */
@@ -93,6 +93,42 @@ RNNOISE_EXPORT void rnnoise_destroy(DenoiseState *st);
  */
 RNNOISE_EXPORT float rnnoise_process_frame(DenoiseState *st, float *out, const float *in);
 
+/**
+ * Compute the voice probability of a frame of samples, without denoising
+ *
+ * Only the analysis and the voice activity part of the network are run.
+ * The state stays valid for rnnoise_process_frame(), which resumes with
+ * the denoising restarted as after rnnoise_init().
+ *
+ * in must be at least rnnoise_get_frame_size() large.
+ */
+RNNOISE_EXPORT float rnnoise_process_frame_vad(DenoiseState *st, const float *in);
+
+/**
+ * Denoise a frame of samples for each of n independent streams
+ *
+ * The neural network is run on the streams together, each weight being
+ * loaded once for several streams. The result is the same as calling
+ * rnnoise_process_frame() on each stream. st, out and in are arrays of n
+ * states and frames, vad_prob receives the n voice probabilities and can
+ * be NULL. Streams sharing the same model are batched.
+ */
+RNNOISE_EXPORT void rnnoise_process_frames(DenoiseState **st, float **out, const float **in, float *vad_prob, int n);
+
+/**
+ * Compute the suppression gains of a frame analyzed by another transform
+ *
+ * power is the power spectrum of a 10 ms frame, in bins of 50 Hz from 0 to
+ * 24 kHz, with the scale of the windowed FFT of rnnoise_process_frame()
+ * (input in 16 bits range). pitch_period is the pitch in samples at 48 kHz,
+ * and pitch_corr its normalized correlation, 0 when no pitch is found.
+ * gains receives the gain of each bin, and the voice probability is
+ * returned. The time domain state of rnnoise_process_frame() is not used.
+ *
+ * power and gains must be rnnoise_get_frame_size() + 1 large.
+ */
+RNNOISE_EXPORT float rnnoise_process_spectrum(DenoiseState *st, float *gains, const float *power, float pitch_corr, int pitch_period);
+
 /**
  * Load a model from a file
  *
@@ -3,6 +3,11 @@
 #include <cstdlib>
 #include <cstring>
 #include "include/lc3.h"
+#include "include/lc3_frontend.h"
+#include "include/lc3_ratectl.h"
+#include "include/lc3_fec.h"
+#include "include/lc3_packet.h"
+#include "include/lc3_denoise.h"
 #include <android/log.h>
 
 #define LOG_TAG "LC3JNI"
@@ -31,6 +36,34 @@ Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeEncoder(JNIEnv *env, jclas
     free(encMem);
 }
 
+// Lower levels skip parts of the analysis, to save battery, see lc3.h
+extern "C" JNIEXPORT jint JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_setEncoderComplexity(JNIEnv *env, jclass clazz, jlong encPtr, jint level) {
+    lc3_encoder_t encoder = (lc3_encoder_t)reinterpret_cast<void*>(encPtr);
+    if (!encoder) return -1;
+
+    return lc3_encoder_set_complexity(encoder, static_cast<enum lc3_complexity>(level));
+}
+
+// Noise suppression of the frames, applied by the encoder on its spectrum, see lc3_denoise.h
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initDenoiser(JNIEnv *env, jclass clazz, jlong encPtr) {
+    lc3_encoder_t encoder = (lc3_encoder_t)reinterpret_cast<void*>(encPtr);
+    if (!encoder) return 0;
+
+    return reinterpret_cast<jlong>(lc3_denoiser_create(encoder));
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeDenoiser(JNIEnv *env, jclass clazz, jlong denoiserPtr) {
+    lc3_denoiser_destroy(reinterpret_cast<lc3_denoiser_t>(denoiserPtr));
+}
+
+extern "C" JNIEXPORT jfloat JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_getDenoiserVad(JNIEnv *env, jclass clazz, jlong denoiserPtr) {
+    return lc3_denoiser_vad(reinterpret_cast<lc3_denoiser_t>(denoiserPtr));
+}
+
 extern "C" JNIEXPORT jlong JNICALL
 Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initDecoder(JNIEnv *env, jclass clazz) {
     int dtUs = 10000;
@@ -54,6 +87,15 @@ Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeDecoder(JNIEnv *env, jclas
     free(decMem);
 }
 
+// Reduced synthesis when the audio goes to speech recognition, see lc3.h
+extern "C" JNIEXPORT jint JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_setDecoderMode(JNIEnv *env, jclass clazz, jlong decPtr, jint mode) {
+    lc3_decoder_t decoder = (lc3_decoder_t)reinterpret_cast<void*>(decPtr);
+    if (!decoder) return -1;
+
+    return lc3_decoder_set_mode(decoder, static_cast<enum lc3_decoder_mode>(mode));
+}
+
 // persistent_encoder.cpp
 
 extern "C" JNIEXPORT jbyteArray JNICALL
@@ -146,3 +188,413 @@ Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_decodeLC3(JNIEnv *env, jclass
     free(outBuf);
     return resultArray;
 }
+
+// Band energies in dB of each frame, without synthesis of the audio, see lc3.h
+extern "C" JNIEXPORT jfloatArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_decodeLC3Energies(JNIEnv *env, jclass clazz, jlong decPtr, jbyteArray lc3Data) {
+    lc3_decoder_t decoder = (lc3_decoder_t)reinterpret_cast<void*>(decPtr);
+    if (!decoder) return env->NewFloatArray(0);
+
+    jbyte *lc3Bytes = env->GetByteArrayElements(lc3Data, nullptr);
+    int lc3Length = env->GetArrayLength(lc3Data);
+
+    int dtUs = 10000;
+    int srHz = 16000;
+    int bands = lc3_energy_bands(dtUs, srHz);
+    int encodedFrameSize = 20;
+
+    int outSize = (lc3Length / encodedFrameSize) * bands;
+    float* outArray = (float*)malloc((outSize > 0 ? outSize : 1) * sizeof(float));
+
+    int offset = 0;
+    for (int i = 0; i <= lc3Length - encodedFrameSize; i += encodedFrameSize) {
+        unsigned char* framePtr = reinterpret_cast<unsigned char*>(lc3Bytes + i);
+        lc3_decode_energies(decoder, framePtr, encodedFrameSize, outArray + offset);
+        offset += bands;
+    }
+
+    jfloatArray resultArray = env->NewFloatArray(outSize);
+    env->SetFloatArrayRegion(resultArray, 0, outSize, outArray);
+
+    env->ReleaseByteArrayElements(lc3Data, lc3Bytes, JNI_ABORT);
+    free(outArray);
+    return resultArray;
+}
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initFrontend(JNIEnv *env, jclass clazz, jint sampleRateHz, jint channels) {
+    int dtUs = 10000;
+    int srHz = 16000;
+    lc3_frontend_t frontend = lc3_frontend_create(dtUs, srHz, sampleRateHz, channels);
+    return reinterpret_cast<jlong>(frontend);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeFrontend(JNIEnv *env, jclass clazz, jlong frontendPtr) {
+    lc3_frontend_destroy(reinterpret_cast<lc3_frontend_t>(frontendPtr));
+}
+
+extern "C" JNIEXPORT jbyteArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_encodeLC3Frontend(JNIEnv *env, jclass clazz, jlong frontendPtr, jshortArray pcmData) {
+    lc3_frontend_t frontend = reinterpret_cast<lc3_frontend_t>(frontendPtr);
+    if (!frontend) return env->NewByteArray(0);
+
+    // The samples are interleaved as given on creation of the front end
+    int channels = lc3_frontend_channels(frontend);
+
+    jshort* pcmSamples = env->GetShortArrayElements(pcmData, nullptr);
+    int samplesPerChannel = env->GetArrayLength(pcmData) / channels;
+    int encodedFrameSize = 20;
+
+    // Samples not filling a frame are kept by the front end for the next call
+    int maxFrames = lc3_frontend_max_frames(frontend, samplesPerChannel);
+    unsigned char* encodedData = (unsigned char*)malloc((maxFrames > 0 ? maxFrames : 1) * encodedFrameSize);
+
+    int frameCount = lc3_frontend_encode(frontend, LC3_PCM_FORMAT_S16, pcmSamples,
+                                         samplesPerChannel, encodedFrameSize, encodedData);
+    int outputSize = (frameCount > 0 ? frameCount : 0) * encodedFrameSize;
+
+    jbyteArray resultArray = env->NewByteArray(outputSize);
+    env->SetByteArrayRegion(resultArray, 0, outputSize, (jbyte*)encodedData);
+
+    free(encodedData);
+    env->ReleaseShortArrayElements(pcmData, pcmSamples, JNI_ABORT);
+
+    return resultArray;
+}
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initRateControl(JNIEnv *env, jclass clazz, jint minBytes, jint maxBytes) {
+    int dtUs = 10000;
+    lc3_ratectl_t* ctl = (lc3_ratectl_t*)malloc(sizeof(lc3_ratectl_t));
+    if (!ctl) return 0;
+
+    if (lc3_ratectl_setup(ctl, dtUs, minBytes, maxBytes) < 0) {
+        free(ctl);
+        return 0;
+    }
+
+    return reinterpret_cast<jlong>(ctl);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeRateControl(JNIEnv *env, jclass clazz, jlong ctlPtr) {
+    free(reinterpret_cast<void*>(ctlPtr));
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_updateLinkStats(JNIEnv *env, jclass clazz, jlong ctlPtr,
+                                                                  jint queuedFrames, jint sentFrames, jint lostFrames, jint throughputBps) {
+    lc3_ratectl_t* ctl = reinterpret_cast<lc3_ratectl_t*>(ctlPtr);
+    if (!ctl) return;
+
+    struct lc3_ratectl_link link = { queuedFrames, sentFrames, lostFrames, throughputBps };
+    lc3_ratectl_update(ctl, &link);
+}
+
+// Each output frame is prefixed by its size byte, see lc3_ratectl.h
+extern "C" JNIEXPORT jbyteArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_encodeLC3Adaptive(JNIEnv *env, jclass clazz, jlong encPtr, jlong ctlPtr, jbyteArray pcmData) {
+    lc3_encoder_t encoder = (lc3_encoder_t)reinterpret_cast<void*>(encPtr);
+    lc3_ratectl_t* ctl = reinterpret_cast<lc3_ratectl_t*>(ctlPtr);
+    if (!encoder || !ctl) return env->NewByteArray(0);
+
+    jbyte* pcmBytes = env->GetByteArrayElements(pcmData, nullptr);
+    int pcmLength = env->GetArrayLength(pcmData);
+
+    int dtUs = 10000;
+    int srHz = 16000;
+    int samplesPerFrame = lc3_frame_samples(dtUs, srHz);
+    int bytesPerFrame = samplesPerFrame * 2;
+    int frameCount = pcmLength / bytesPerFrame;
+
+    unsigned char* encodedData = (unsigned char*)malloc(
+            (frameCount > 0 ? frameCount : 1) * (LC3_RATECTL_HEADER_BYTES + LC3_RATECTL_MAX_FRAME_BYTES));
+    int outputSize = 0;
+
+    for (int i = 0; i < frameCount; i++) {
+        const int16_t* framePcm = reinterpret_cast<const int16_t*>(pcmBytes + i * bytesPerFrame);
+        int written = lc3_ratectl_encode(ctl, encoder, LC3_PCM_FORMAT_S16, framePcm, 1,
+                                         encodedData + outputSize);
+        if (written > 0) outputSize += written;
+    }
+
+    jbyteArray resultArray = env->NewByteArray(outputSize);
+    env->SetByteArrayRegion(resultArray, 0, outputSize, (jbyte*)encodedData);
+
+    free(encodedData);
+    env->ReleaseByteArrayElements(pcmData, pcmBytes, JNI_ABORT);
+
+    return resultArray;
+}
+
+extern "C" JNIEXPORT jbyteArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_decodeLC3Adaptive(JNIEnv *env, jclass clazz, jlong decPtr, jbyteArray lc3Data) {
+    lc3_decoder_t decoder = (lc3_decoder_t)reinterpret_cast<void*>(decPtr);
+    if (!decoder) return env->NewByteArray(0);
+
+    jbyte* lc3Bytes = env->GetByteArrayElements(lc3Data, nullptr);
+    int lc3Length = env->GetArrayLength(lc3Data);
+
+    int dtUs = 10000;
+    int srHz = 16000;
+    int samplesPerFrame = lc3_frame_samples(dtUs, srHz);
+    int bytesPerFrame = samplesPerFrame * 2;
+
+    // Smallest frame is the header plus 20 bytes
+    int maxFrames = lc3Length / (LC3_RATECTL_HEADER_BYTES + LC3_MIN_FRAME_BYTES) + 1;
+    unsigned char* outArray = (unsigned char*)malloc(maxFrames * bytesPerFrame);
+    int outSize = 0;
+
+    for (int offset = 0; offset < lc3Length; ) {
+        int consumed = lc3_ratectl_decode(decoder, lc3Bytes + offset, lc3Length - offset,
+                                          LC3_PCM_FORMAT_S16, outArray + outSize, 1);
+        outSize += bytesPerFrame;
+        if (consumed < 0) break;
+        offset += consumed;
+    }
+
+    jbyteArray resultArray = env->NewByteArray(outSize);
+    env->SetByteArrayRegion(resultArray, 0, outSize, (jbyte*)outArray);
+
+    free(outArray);
+    env->ReleaseByteArrayElements(lc3Data, lc3Bytes, JNI_ABORT);
+
+    return resultArray;
+}
+
+// Each packet carries a low rate copy of the frame `delay` packets before, see lc3_fec.h
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initFecEncoder(JNIEnv *env, jclass clazz, jint frameBytes, jint fecBytes, jint delay) {
+    lc3_fec_encoder_t* fec = (lc3_fec_encoder_t*)malloc(sizeof(lc3_fec_encoder_t));
+    if (!fec) return 0;
+
+    if (lc3_fec_setup_encoder(fec, frameBytes, fecBytes, delay) < 0) {
+        free(fec);
+        return 0;
+    }
+
+    return reinterpret_cast<jlong>(fec);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeFecEncoder(JNIEnv *env, jclass clazz, jlong fecPtr) {
+    free(reinterpret_cast<void*>(fecPtr));
+}
+
+extern "C" JNIEXPORT jbyteArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_encodeLC3Fec(JNIEnv *env, jclass clazz, jlong encPtr, jlong fecPtr, jbyteArray pcmData) {
+    lc3_encoder_t encoder = (lc3_encoder_t)reinterpret_cast<void*>(encPtr);
+    lc3_fec_encoder_t* fec = reinterpret_cast<lc3_fec_encoder_t*>(fecPtr);
+    if (!encoder || !fec) return env->NewByteArray(0);
+
+    jbyte* pcmBytes = env->GetByteArrayElements(pcmData, nullptr);
+    int pcmLength = env->GetArrayLength(pcmData);
+
+    int dtUs = 10000;
+    int srHz = 16000;
+    int samplesPerFrame = lc3_frame_samples(dtUs, srHz);
+    int bytesPerFrame = samplesPerFrame * 2;
+    int frameCount = pcmLength / bytesPerFrame;
+    int packetSize = fec->nbytes + fec->nbytes_fec;
+
+    unsigned char* encodedData = (unsigned char*)malloc((frameCount > 0 ? frameCount : 1) * packetSize);
+    int outputSize = 0;
+
+    for (int i = 0; i < frameCount; i++) {
+        const int16_t* framePcm = reinterpret_cast<const int16_t*>(pcmBytes + i * bytesPerFrame);
+        if (lc3_fec_encode(fec, encoder, LC3_PCM_FORMAT_S16, framePcm, 1, encodedData + outputSize) == 0)
+            outputSize += packetSize;
+    }
+
+    jbyteArray resultArray = env->NewByteArray(outputSize);
+    env->SetByteArrayRegion(resultArray, 0, outputSize, (jbyte*)encodedData);
+
+    free(encodedData);
+    env->ReleaseByteArrayElements(pcmData, pcmBytes, JNI_ABORT);
+
+    return resultArray;
+}
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initFecDecoder(JNIEnv *env, jclass clazz, jint frameBytes, jint fecBytes, jint delay) {
+    lc3_fec_decoder_t* fec = (lc3_fec_decoder_t*)malloc(sizeof(lc3_fec_decoder_t));
+    if (!fec) return 0;
+
+    if (lc3_fec_setup_decoder(fec, frameBytes, fecBytes, delay) < 0) {
+        free(fec);
+        return 0;
+    }
+
+    return reinterpret_cast<jlong>(fec);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeFecDecoder(JNIEnv *env, jclass clazz, jlong fecPtr) {
+    free(reinterpret_cast<void*>(fecPtr));
+}
+
+// One packet in, one frame out, `delay` frames late. A null packet marks a lost one.
+extern "C" JNIEXPORT jbyteArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_decodeLC3Fec(JNIEnv *env, jclass clazz, jlong decPtr, jlong fecPtr, jbyteArray packet) {
+    lc3_decoder_t decoder = (lc3_decoder_t)reinterpret_cast<void*>(decPtr);
+    lc3_fec_decoder_t* fec = reinterpret_cast<lc3_fec_decoder_t*>(fecPtr);
+    if (!decoder || !fec) return env->NewByteArray(0);
+
+    int dtUs = 10000;
+    int srHz = 16000;
+    int samplesPerFrame = lc3_frame_samples(dtUs, srHz);
+    int bytesPerFrame = samplesPerFrame * 2;
+
+    jbyte* packetBytes = nullptr;
+    if (packet && env->GetArrayLength(packet) == fec->nbytes + fec->nbytes_fec)
+        packetBytes = env->GetByteArrayElements(packet, nullptr);
+
+    int16_t* outBuf = (int16_t*)malloc(bytesPerFrame);
+    lc3_fec_decode(fec, decoder, packetBytes, LC3_PCM_FORMAT_S16, outBuf, 1);
+
+    jbyteArray resultArray = env->NewByteArray(bytesPerFrame);
+    env->SetByteArrayRegion(resultArray, 0, bytesPerFrame, (jbyte*)outBuf);
+
+    free(outBuf);
+    if (packetBytes)
+        env->ReleaseByteArrayElements(packet, packetBytes, JNI_ABORT);
+
+    return resultArray;
+}
+
+// Frames packed in notifications of `packetSize` bytes, behind a sequence header, see lc3_packet.h
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initPacketizer(JNIEnv *env, jclass clazz, jint packetSize, jboolean variableSize) {
+    // The packet buffer follows the state
+    lc3_packetizer_t* pk = (lc3_packetizer_t*)malloc(sizeof(lc3_packetizer_t) + (packetSize > 0 ? packetSize : 0));
+    if (!pk) return 0;
+
+    if (lc3_packetizer_setup(pk, packetSize, variableSize) < 0) {
+        free(pk);
+        return 0;
+    }
+
+    lc3_packetizer_begin(pk, pk + 1);
+    return reinterpret_cast<jlong>(pk);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freePacketizer(JNIEnv *env, jclass clazz, jlong pkPtr) {
+    free(reinterpret_cast<void*>(pkPtr));
+}
+
+static jbyteArray takePacket(JNIEnv *env, lc3_packetizer_t* pk) {
+    int size = lc3_packetizer_end(pk);
+    jbyteArray packet = env->NewByteArray(size);
+    env->SetByteArrayRegion(packet, 0, size, (jbyte*)(pk + 1));
+
+    lc3_packetizer_begin(pk, pk + 1);
+    return packet;
+}
+
+// Returns the completed packets, the last frames stay pending until the packet is full
+extern "C" JNIEXPORT jobjectArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_encodeLC3Packets(JNIEnv *env, jclass clazz, jlong encPtr, jlong pkPtr, jbyteArray pcmData, jint frameBytes) {
+    lc3_encoder_t encoder = (lc3_encoder_t)reinterpret_cast<void*>(encPtr);
+    lc3_packetizer_t* pk = reinterpret_cast<lc3_packetizer_t*>(pkPtr);
+    jclass byteArrayClass = env->FindClass("[B");
+    if (!encoder || !pk) return env->NewObjectArray(0, byteArrayClass, nullptr);
+
+    jbyte* pcmBytes = env->GetByteArrayElements(pcmData, nullptr);
+    int pcmLength = env->GetArrayLength(pcmData);
+
+    int dtUs = 10000;
+    int srHz = 16000;
+    int samplesPerFrame = lc3_frame_samples(dtUs, srHz);
+    int bytesPerFrame = samplesPerFrame * 2;
+    int frameCount = pcmLength / bytesPerFrame;
+
+    jbyteArray* packets = (jbyteArray*)malloc((frameCount > 0 ? frameCount : 1) * sizeof(jbyteArray));
+    int packetCount = 0;
+
+    for (int i = 0; i < frameCount; i++) {
+        void* frame = lc3_packetizer_add(pk, frameBytes);
+        if (!frame && pk->count > 0) {
+            packets[packetCount++] = takePacket(env, pk);
+            frame = lc3_packetizer_add(pk, frameBytes);
+        }
+        if (!frame) break;
+
+        // Encoded in place, in the packet buffer
+        const int16_t* framePcm = reinterpret_cast<const int16_t*>(pcmBytes + i * bytesPerFrame);
+        lc3_encode(encoder, LC3_PCM_FORMAT_S16, framePcm, 1, frameBytes, frame);
+    }
+
+    jobjectArray resultArray = env->NewObjectArray(packetCount, byteArrayClass, nullptr);
+    for (int i = 0; i < packetCount; i++) {
+        env->SetObjectArrayElement(resultArray, i, packets[i]);
+        env->DeleteLocalRef(packets[i]);
+    }
+
+    free(packets);
+    env->ReleaseByteArrayElements(pcmData, pcmBytes, JNI_ABORT);
+
+    return resultArray;
+}
+
+// Returns the pending frames as a last packet, empty when none
+extern "C" JNIEXPORT jbyteArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_flushPacketizer(JNIEnv *env, jclass clazz, jlong pkPtr) {
+    lc3_packetizer_t* pk = reinterpret_cast<lc3_packetizer_t*>(pkPtr);
+    if (!pk) return env->NewByteArray(0);
+
+    return takePacket(env, pk);
+}
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_initDepacketizer(JNIEnv *env, jclass clazz) {
+    lc3_depacketizer_t* dp = (lc3_depacketizer_t*)malloc(sizeof(lc3_depacketizer_t));
+    if (!dp) return 0;
+
+    lc3_depacketizer_setup(dp);
+    return reinterpret_cast<jlong>(dp);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_freeDepacketizer(JNIEnv *env, jclass clazz, jlong dpPtr) {
+    free(reinterpret_cast<void*>(dpPtr));
+}
+
+// Decodes the frames of a packet, preceded by the concealment of the lost ones.
+// A malformed, late or duplicated packet gives an empty result.
+extern "C" JNIEXPORT jbyteArray JNICALL
+Java_com_augmentos_smartglassesmanager_cpp_L3cCpp_decodeLC3Packet(JNIEnv *env, jclass clazz, jlong decPtr, jlong dpPtr, jbyteArray packet) {
+    lc3_decoder_t decoder = (lc3_decoder_t)reinterpret_cast<void*>(decPtr);
+    lc3_depacketizer_t* dp = reinterpret_cast<lc3_depacketizer_t*>(dpPtr);
+    if (!decoder || !dp) return env->NewByteArray(0);
+
+    jbyte* packetBytes = env->GetByteArrayElements(packet, nullptr);
+    int packetLength = env->GetArrayLength(packet);
+
+    int dtUs = 10000;
+    int srHz = 16000;
+    int samplesPerFrame = lc3_frame_samples(dtUs, srHz);
+    int bytesPerFrame = samplesPerFrame * 2;
+
+    int lost = lc3_depacketizer_put(dp, packetBytes, packetLength);
+    int frameCount = lost < 0 ? 0 : lost + dp->count;
+
+    unsigned char* outArray = (unsigned char*)malloc((frameCount > 0 ? frameCount : 1) * bytesPerFrame);
+    int outSize = 0;
+
+    const void* frame;
+    for (int i = 0; i < frameCount; i++) {
+        int nbytes = lc3_depacketizer_get(dp, &frame);
+        lc3_decode(decoder, frame, nbytes, LC3_PCM_FORMAT_S16, outArray + outSize, 1);
+        outSize += bytesPerFrame;
+    }
+
+    jbyteArray resultArray = env->NewByteArray(outSize);
+    env->SetByteArrayRegion(resultArray, 0, outSize, (jbyte*)outArray);
+
+    free(outArray);
+    env->ReleaseByteArrayElements(packet, packetBytes, JNI_ABORT);
+
+    return resultArray;
+}
@@ -369,7 +369,19 @@ LC3_HOT unsigned lc3_get_bits_generic(struct lc3_bits *bits, int n)
 LC3_HOT void lc3_ac_read_renorm(struct lc3_bits *bits)
 {
     struct lc3_bits_ac *ac = &bits->ac;
+    struct lc3_bits_buffer *buffer = &bits->buffer;
+
+    /* --- The range cannot fall below 2^6, so that at most 2 bytes
+     *     are shifted in. Load them at once, when in the buffer --- */
+
+    if (ac->range < 0x100 && buffer->end - buffer->p_fw >= 2) {
+        ac->low = ((ac->low << 16) |
+            buffer->p_fw[0] << 8 | buffer->p_fw[1]) & 0xffffff;
+        ac->range <<= 16;
+        buffer->p_fw += 2;
+        return;
+    }
 
     for ( ; ac->range < 0x10000; ac->range <<= 8)
-        ac->low = ((ac->low << 8) | ac_get(&bits->buffer)) & 0xffffff;
+        ac->low = ((ac->low << 8) | ac_get(buffer)) & 0xffffff;
 }
@@ -25,6 +25,9 @@
 enum lc3_bandwidth lc3_bwdet_run(
     enum lc3_dt dt, enum lc3_srate sr, const float *e)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     /* Bandwidth regions (Table 3.6)  */
 
     struct region { int is : 8; int ie : 8; };
@@ -32,6 +35,20 @@ enum lc3_bandwidth lc3_bwdet_run(
     static const struct region bws_table[LC3_NUM_DT]
             [LC3_NUM_BANDWIDTH-1][LC3_NUM_BANDWIDTH-1] = {
 
+        [LC3_DT_2M5] = {
+            { { 24, 39+1 } },
+            { { 24, 40+1 }, { 46, 59+1 } },
+            { { 24, 41+1 }, { 44, 59+1 }, { 60, 63+1 } },
+            { { 23, 40+1 }, { 44, 55+1 }, { 57, 60+1 }, { 61, 63+1 } },
+        },
+
+        [LC3_DT_5M] = {
+            { { 48, 63+1 } },
+            { { 47, 56+1 }, { 59, 63+1 } },
+            { { 44, 52+1 }, { 54, 59+1 }, { 60, 63+1 } },
+            { { 41, 49+1 }, { 51, 55+1 }, { 57, 60+1 }, { 61, 63+1 } },
+        },
+
         [LC3_DT_7M5] = {
             { { 51, 63+1 } },
             { { 45, 55+1 }, { 58, 63+1 } },
@@ -48,6 +65,8 @@ enum lc3_bandwidth lc3_bwdet_run(
     };
 
     static const int l_table[LC3_NUM_DT][LC3_NUM_BANDWIDTH-1] = {
+        [LC3_DT_2M5] = { 4, 4, 3, 1 },
+        [LC3_DT_5M ] = { 4, 4, 3, 1 },
         [LC3_DT_7M5] = { 4, 4, 3, 2 },
         [LC3_DT_10M] = { 4, 4, 3, 1 },
     };
@@ -87,12 +87,65 @@
  */
 
 #define LC3_DT_US(dt) \
-    ( (3 + (dt)) * 2500 )
+    ( (1 + (dt)) * 2500 )
 
 #define LC3_SRATE_KHZ(sr) \
     ( (1 + (sr) + ((sr) == LC3_SRATE_48K)) * 8 )
 
 
+/**
+ * Fixed configuration
+ *
+ * Defining `LC3_FIXED_DT_US` and `LC3_FIXED_SR_HZ` at build time restricts
+ * the library to this frame duration and samplerate, others are rejected
+ * on setup. The entry points of modules bind their `dt` and `sr` to the
+ * constants, so that loop bounds and tables indexes are resolved at
+ * compile time. The tables of other configurations are not built.
+ *
+ *   LC3_WITH_DT(us)  True when frame duration in us is built
+ *   LC3_WITH_SR(hz)  True when samplerate in Hz is built
+ *   LC3_BIND_DT(dt)  Bind a frame duration to the fixed one
+ *   LC3_BIND_SR(sr)  Bind a samplerate to the fixed one
+ *   LC3_WITH(us, hz, x)  `x` when the configuration is built, NULL otherwise
+ */
+
+#if defined(LC3_FIXED_DT_US) && defined(LC3_FIXED_SR_HZ)
+
+#if !LC3_CHECK_DT_US(LC3_FIXED_DT_US)
+#error "LC3_FIXED_DT_US is not a suitable frame duration"
+#endif
+
+#define LC3_FIXED_DT \
+    ( LC3_FIXED_DT_US == 2500 ? LC3_DT_2M5 : \
+      LC3_FIXED_DT_US == 5000 ? LC3_DT_5M  : \
+      LC3_FIXED_DT_US == 7500 ? LC3_DT_7M5 : LC3_DT_10M )
+
+#define LC3_FIXED_SR \
+    ( LC3_FIXED_SR_HZ ==  8000 ? LC3_SRATE_8K  : \
+      LC3_FIXED_SR_HZ == 16000 ? LC3_SRATE_16K : \
+      LC3_FIXED_SR_HZ == 24000 ? LC3_SRATE_24K : \
+      LC3_FIXED_SR_HZ == 32000 ? LC3_SRATE_32K : LC3_SRATE_48K )
+
+#define LC3_WITH_DT(us)  ( (us) == LC3_FIXED_DT_US )
+#define LC3_WITH_SR(hz)  ( (hz) == LC3_FIXED_SR_HZ )
+
+#define LC3_BIND_DT(dt)  ( (void)((dt) = LC3_FIXED_DT) )
+#define LC3_BIND_SR(sr)  ( (void)((sr) = LC3_FIXED_SR) )
+
+#else /* LC3_FIXED_DT_US && LC3_FIXED_SR_HZ */
+
+#define LC3_WITH_DT(us)  1
+#define LC3_WITH_SR(hz)  1
+
+#define LC3_BIND_DT(dt)  ( (void)(dt) )
+#define LC3_BIND_SR(sr)  ( (void)(sr) )
+
+#endif /* LC3_FIXED_DT_US && LC3_FIXED_SR_HZ */
+
+#define LC3_WITH(us, hz, x) \
+    ( LC3_WITH_DT(us) && LC3_WITH_SR(hz) ? (x) : NULL )
+
+
 /**
  * Return number of samples, delayed samples and
  * encoded spectrum coefficients within a frame
@@ -101,14 +154,15 @@
  */
 
 #define LC3_NS(dt, sr) \
-    ( 20 * (3 + (dt)) * (1 + (sr) + ((sr) == LC3_SRATE_48K)) )
+    ( 20 * (1 + (dt)) * (1 + (sr) + ((sr) == LC3_SRATE_48K)) )
 
 #define LC3_ND(dt, sr) \
-    ( (dt) == LC3_DT_7M5 ? 23 * LC3_NS(dt, sr) / 30 \
-                         :  5 * LC3_NS(dt, sr) /  8 )
+    ( (dt) == LC3_DT_10M ?  5 * LC3_NS(dt, sr) /  8 : \
+      (dt) == LC3_DT_7M5 ? 23 * LC3_NS(dt, sr) / 30 : \
+                            3 * LC3_NS(dt, sr) /  5 )
 
 #define LC3_NE(dt, sr) \
-    ( 20 * (3 + (dt)) * (1 + (sr)) )
+    ( 20 * (1 + (dt)) * (1 + (sr)) )
 
 #define LC3_MAX_NE \
     LC3_NE(LC3_DT_10M, LC3_SRATE_48K)
@@ -117,7 +171,7 @@
     ( (5 * LC3_SRATE_KHZ(sr)) / 4 )
 
 #define LC3_NH(dt, sr) \
-    ( ((3 - dt) + 1) * LC3_NS(dt, sr) )
+    ( (2 + 18000 / LC3_DT_US(dt)) * LC3_NS(dt, sr) )
 
 
 /**
@@ -0,0 +1,493 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <lc3_container.h>
+#include <stdlib.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common.h"
+
+
+/**
+ * Layout
+ */
+
+#define HEADER_SIZE        32
+#define BLOCK_HEADER_SIZE  16
+#define TRAILER_SIZE       16
+
+#define VERSION            1
+
+#define BLOCK_FRAMES       100
+#define BLOCK_DATA_MAX     (BLOCK_FRAMES * LC3_MAX_FRAME_BYTES)
+
+#define MAGIC(a, b, c, d) \
+    ( (uint32_t)(a) | (uint32_t)(b) << 8 | \
+      (uint32_t)(c) << 16 | (uint32_t)(d) << 24 )
+
+#define FILE_MAGIC   MAGIC('L', 'C', '3', 'F')
+#define BLOCK_MAGIC  MAGIC('L', 'C', '3', 'B')
+#define INDEX_MAGIC  MAGIC('L', 'C', '3', 'I')
+
+
+/**
+ * Writer state
+ */
+
+struct lc3_writer {
+    int fd;
+    struct lc3_container_info info;
+
+    int64_t nframes;
+    uint64_t offset;
+
+    uint64_t *index;
+    int nblocks, index_size;
+
+    int nf, size;
+    uint8_t block[BLOCK_HEADER_SIZE + 2*BLOCK_FRAMES];
+    uint8_t data[BLOCK_DATA_MAX];
+};
+
+/**
+ * Reader state
+ */
+
+struct lc3_reader {
+    const uint8_t *map;
+    size_t map_size;
+
+    struct lc3_container_info info;
+    int block_frames;
+
+    const uint8_t *index;
+    uint64_t *rebuilt_index;
+    int nblocks;
+};
+
+
+/* ----------------------------------------------------------------------------
+ *  Little endian fields
+ * -------------------------------------------------------------------------- */
+
+static inline void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xff; p[1] = v >> 8;
+}
+
+static inline void put_u32(uint8_t *p, uint32_t v)
+{
+    put_u16(p, v & 0xffff); put_u16(p + 2, v >> 16);
+}
+
+static inline void put_u64(uint8_t *p, uint64_t v)
+{
+    put_u32(p, v & 0xffffffff); put_u32(p + 4, v >> 32);
+}
+
+static inline uint16_t get_u16(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static inline uint32_t get_u32(const uint8_t *p)
+{
+    return get_u16(p) | (uint32_t)get_u16(p + 2) << 16;
+}
+
+static inline uint64_t get_u64(const uint8_t *p)
+{
+    return get_u32(p) | (uint64_t)get_u32(p + 4) << 32;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Writer
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Write a buffer completely
+ * fd, p, n        File descriptor, and buffer of `n` bytes
+ * return          0: On success  -1: I/O error
+ */
+static int write_all(int fd, const void *p, size_t n)
+{
+    for (const uint8_t *b = p; n > 0; ) {
+        ssize_t ret = write(fd, b, n);
+        if (ret <= 0)
+            return -1;
+
+        b += ret, n -= ret;
+    }
+
+    return 0;
+}
+
+/**
+ * Write the current block, and record it in the index
+ * writer          Writer state
+ * return          0: On success  -1: I/O error
+ */
+static int flush_block(struct lc3_writer *w)
+{
+    if (w->nf <= 0)
+        return 0;
+
+    if (w->nblocks >= w->index_size) {
+        int size = LC3_MAX(2 * w->index_size, 64);
+        uint64_t *index = realloc(w->index, size * sizeof(*index));
+        if (!index)
+            return -1;
+
+        w->index = index, w->index_size = size;
+    }
+
+    int64_t t = w->info.start_us +
+        (w->nframes - w->nf) * w->info.dt_us;
+
+    put_u32(w->block +  0, BLOCK_MAGIC);
+    put_u16(w->block +  4, w->nf);
+    put_u16(w->block +  6, w->size);
+    put_u64(w->block +  8, t);
+
+    int block_size = BLOCK_HEADER_SIZE + 2*w->nf;
+
+    if (write_all(w->fd, w->block, block_size) < 0 ||
+        write_all(w->fd, w->data, w->size) < 0     )
+        return -1;
+
+    w->index[w->nblocks++] = w->offset;
+    w->offset += block_size + w->size;
+    w->nf = w->size = 0;
+
+    return 0;
+}
+
+/**
+ * Create a container file, and its writer
+ */
+struct lc3_writer *lc3_writer_open(
+    const char *path, const struct lc3_container_info *info)
+{
+    if (lc3_frame_samples(info->dt_us, info->sr_hz) < 0 ||
+        (info->nbytes && (info->nbytes < LC3_MIN_FRAME_BYTES ||
+                          info->nbytes > LC3_MAX_FRAME_BYTES)))
+        return NULL;
+
+    struct lc3_writer *w = malloc(sizeof(*w));
+    if (!w)
+        return NULL;
+
+    *w = (struct lc3_writer){ .info = *info, .offset = HEADER_SIZE };
+    w->info.nframes = 0;
+
+    uint8_t header[HEADER_SIZE] = { 0 };
+
+    put_u32(header +  0, FILE_MAGIC);
+    header[4] = VERSION;
+    put_u16(header +  6, BLOCK_FRAMES);
+    put_u32(header +  8, info->dt_us);
+    put_u32(header + 12, info->sr_hz);
+    put_u16(header + 16, info->nbytes);
+    put_u64(header + 24, info->start_us);
+
+    w->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (w->fd < 0 || write_all(w->fd, header, sizeof(header)) < 0) {
+        if (w->fd >= 0)
+            close(w->fd);
+
+        free(w);
+        return NULL;
+    }
+
+    return w;
+}
+
+/**
+ * Append a frame
+ */
+int lc3_writer_put(struct lc3_writer *w, const void *frame, int nbytes)
+{
+    if (!w || nbytes < 0 || nbytes > LC3_MAX_FRAME_BYTES)
+        return -1;
+
+    if (frame && nbytes > 0) {
+        memcpy(w->data + w->size, frame, nbytes);
+        w->size += nbytes;
+    }
+
+    put_u16(w->block + BLOCK_HEADER_SIZE + 2 * w->nf++, w->size);
+    w->nframes++;
+
+    return w->nf < BLOCK_FRAMES ? 0 : flush_block(w);
+}
+
+/**
+ * Complete the file with its index, and destroy the writer
+ */
+int lc3_writer_close(struct lc3_writer *w)
+{
+    if (!w)
+        return 0;
+
+    int ret = flush_block(w);
+
+    /* --- Serialize the index in place, and write it at once --- */
+
+    for (int i = 0; i < w->nblocks; i++)
+        put_u64((uint8_t *)(w->index + i), w->index[i]);
+
+    if (ret == 0)
+        ret = write_all(w->fd, w->index, w->nblocks * sizeof(*w->index));
+
+    if (ret == 0) {
+        uint8_t trailer[TRAILER_SIZE];
+
+        put_u64(trailer +  0, w->offset);
+        put_u32(trailer +  8, w->nblocks);
+        put_u32(trailer + 12, INDEX_MAGIC);
+        ret = write_all(w->fd, trailer, sizeof(trailer));
+    }
+
+    if (close(w->fd) < 0)
+        ret = -1;
+
+    free(w->index);
+    free(w);
+
+    return ret;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Reader
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Return the offset of a block
+ * reader          Reader state
+ * i               Index of the block, in range 0 to `nblocks - 1`
+ * return          Offset of the block in the file
+ */
+static inline uint64_t block_offset(const struct lc3_reader *r, int i)
+{
+    return r->index ? get_u64(r->index + 8*i) : r->rebuilt_index[i];
+}
+
+/**
+ * Check the block at an offset
+ * reader          Reader state
+ * offset          Offset of the block
+ * return          Size of the block, 0 when not valid
+ */
+static size_t check_block(const struct lc3_reader *r, uint64_t offset)
+{
+    if (offset > r->map_size || r->map_size - offset < BLOCK_HEADER_SIZE)
+        return 0;
+
+    const uint8_t *p = r->map + offset;
+    int nf = get_u16(p + 4);
+    size_t size = BLOCK_HEADER_SIZE + 2*nf + get_u16(p + 6);
+
+    if (get_u32(p) != BLOCK_MAGIC || nf <= 0 || nf > r->block_frames ||
+            r->map_size - offset < size)
+        return 0;
+
+    return size;
+}
+
+/**
+ * Locate the index, or rebuild it by walking through the blocks
+ * reader          Reader state
+ * return          0: On success  -1: Bad or empty file
+ */
+static int load_index(struct lc3_reader *r)
+{
+    /* --- Index written on completion --- */
+
+    if (r->map_size >= HEADER_SIZE + TRAILER_SIZE) {
+        const uint8_t *trailer = r->map + r->map_size - TRAILER_SIZE;
+        uint64_t offset = get_u64(trailer);
+        uint32_t nblocks = get_u32(trailer + 8);
+
+        if (get_u32(trailer + 12) == INDEX_MAGIC && offset >= HEADER_SIZE &&
+                offset <= r->map_size - TRAILER_SIZE &&
+                nblocks == (r->map_size - TRAILER_SIZE - offset) / 8 &&
+                nblocks <= INT_MAX) {
+            r->index = r->map + offset;
+            r->nblocks = nblocks;
+            return 0;
+        }
+    }
+
+    /* --- Interrupted recording, walk through the blocks --- */
+
+    int size = 0;
+
+    for (uint64_t offset = HEADER_SIZE; ; ) {
+        size_t block_size = check_block(r, offset);
+        if (!block_size)
+            break;
+
+        if (r->nblocks >= size) {
+            size = LC3_MAX(2 * size, 64);
+            uint64_t *index = realloc(r->rebuilt_index, size * sizeof(*index));
+            if (!index)
+                return -1;
+
+            r->rebuilt_index = index;
+        }
+
+        r->rebuilt_index[r->nblocks++] = offset;
+        offset += block_size;
+
+        if (get_u16(r->map + offset - block_size + 4) < r->block_frames)
+            break;
+    }
+
+    return 0;
+}
+
+/**
+ * Open a container file
+ */
+struct lc3_reader *lc3_reader_open(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    void *map = MAP_FAILED;
+
+    if (fstat(fd, &st) == 0 && st.st_size >= HEADER_SIZE)
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (map == MAP_FAILED)
+        return NULL;
+
+    struct lc3_reader *r = malloc(sizeof(*r));
+    if (!r) {
+        munmap(map, st.st_size);
+        return NULL;
+    }
+
+    *r = (struct lc3_reader){ .map = map, .map_size = st.st_size };
+
+    const uint8_t *header = r->map;
+
+    r->block_frames = get_u16(header + 6);
+    r->info = (struct lc3_container_info){
+        .dt_us = get_u32(header +  8),
+        .sr_hz = get_u32(header + 12),
+        .nbytes = get_u16(header + 16),
+        .start_us = get_u64(header + 24),
+    };
+
+    if (get_u32(header) != FILE_MAGIC || header[4] != VERSION ||
+            r->block_frames <= 0 ||
+            lc3_frame_samples(r->info.dt_us, r->info.sr_hz) < 0 ||
+            load_index(r) < 0) {
+        lc3_reader_close(r);
+        return NULL;
+    }
+
+    /* --- Count the frames, all blocks but the last one are complete --- */
+
+    if (r->nblocks > 0) {
+        uint64_t last = block_offset(r, r->nblocks - 1);
+        if (!check_block(r, last)) {
+            lc3_reader_close(r);
+            return NULL;
+        }
+
+        r->info.nframes = (int64_t)(r->nblocks - 1) * r->block_frames +
+            get_u16(r->map + last + 4);
+    }
+
+    return r;
+}
+
+/**
+ * Close a container file
+ */
+void lc3_reader_close(struct lc3_reader *r)
+{
+    if (!r)
+        return;
+
+    munmap((void *)r->map, r->map_size);
+    free(r->rebuilt_index);
+    free(r);
+}
+
+/**
+ * Return the description of the stream
+ */
+void lc3_reader_info(struct lc3_reader *r, struct lc3_container_info *info)
+{
+    *info = r->info;
+}
+
+/**
+ * Locate a frame
+ */
+int lc3_reader_get(struct lc3_reader *r, int64_t n, const void **frame)
+{
+    if (!r || n < 0 || n >= r->info.nframes)
+        return -1;
+
+    int i = n / r->block_frames;
+    int j = n % r->block_frames;
+
+    uint64_t offset = block_offset(r, i);
+    if (!check_block(r, offset) || j >= get_u16(r->map + offset + 4))
+        return -1;
+
+    const uint8_t *p = r->map + offset;
+    const uint8_t *ends = p + BLOCK_HEADER_SIZE;
+    int nf = get_u16(p + 4);
+    int size = get_u16(p + 6);
+
+    int start = j > 0 ? get_u16(ends + 2*(j-1)) : 0;
+    int end = get_u16(ends + 2*j);
+    if (end < start || end > size)
+        return -1;
+
+    *frame = ends + 2*nf + start;
+    return end - start;
+}
+
+/**
+ * Return the frame at a given time
+ */
+int64_t lc3_reader_seek(struct lc3_reader *r, int64_t t_us)
+{
+    if (!r || r->info.nframes <= 0)
+        return 0;
+
+    int64_t n = (t_us - r->info.start_us) / r->info.dt_us;
+
+    return LC3_CLIP(n, 0, r->info.nframes - 1);
+}
@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <lc3_denoise.h>
+#include <stdlib.h>
+
+#include "common.h"
+#include "tables.h"
+
+#include <rnnoise.h>
+
+
+/**
+ * Spectrum of the network, bins of 50 Hz from 0 to 24 KHz
+ * Duration in us of the frames of the network
+ */
+
+#define NUM_BINS  (480 + 1)
+#define FRAME_US  10000
+
+
+/**
+ * Denoiser state
+ */
+
+struct lc3_denoiser {
+    struct lc3_encoder *encoder;
+    DenoiseState *st;
+
+    int nf, acc_us;
+    int pitch;
+    float vad;
+
+    float power[NUM_BINS];
+    float gains[NUM_BINS];
+};
+
+
+/* ----------------------------------------------------------------------------
+ *  Processing
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Denoise the spectrum of a frame
+ * ctx             The denoiser
+ * x               MDCT coefficients of the frame, modified in place
+ * e               Energy estimation per band of the coefficients
+ * return          True, the coefficients are modified
+ */
+static bool denoise(void *ctx, float *x, const float *e)
+{
+    struct lc3_denoiser *denoiser = ctx;
+    struct lc3_encoder *encoder = denoiser->encoder;
+    enum lc3_dt dt = encoder->dt;
+    enum lc3_srate sr = encoder->sr;
+
+    int dt_us = LC3_DT_US(dt);
+    int ns = LC3_NS(dt, sr);
+    int nb = LC3_MIN(LC3_NUM_BANDS, ns);
+    const int *lim = lc3_band_lim[dt][sr];
+
+    /* --- Power spectrum, from the mean energy of the bands ---
+     * The MDCT is about orthonormal, the power of a bin of the network
+     * (windowed FFT of 960 samples at 48 KHz, scaled by 1/960) is the
+     * energy of a coefficient scaled by 48000 / (1920 * sr_hz). */
+
+    float scale = 25.f / (LC3_SRATE_KHZ(sr) * 1000);
+    int nj = (ns * FRAME_US) / dt_us;
+
+    for (int j = 0, b = 0; j < nj; j++) {
+        int k = (j * dt_us) / FRAME_US;
+        while (b < nb-1 && lim[b+1] <= k)
+            b++;
+
+        denoiser->power[j] += scale * e[b];
+    }
+
+    denoiser->nf++;
+    denoiser->acc_us += dt_us;
+
+    /* --- Run the network each 10 ms ---
+     * The analysis of the long term postfilter gives the pitch, in
+     * quarter of samples at 12.8 KHz, and its normalized correlation */
+
+    if (denoiser->acc_us >= FRAME_US) {
+        float corr = 0;
+
+        if (encoder->complexity == LC3_COMPLEXITY_FULL &&
+                encoder->ltpf.pitch > 0) {
+            denoiser->pitch = (encoder->ltpf.pitch * 15) / 16;
+            corr = encoder->ltpf.nc[0];
+        }
+
+        for (int j = 0; j < nj; j++)
+            denoiser->power[j] /= denoiser->nf;
+
+        denoiser->vad = rnnoise_process_spectrum(denoiser->st,
+            denoiser->gains, denoiser->power, corr, denoiser->pitch);
+
+        memset(denoiser->power, 0, nj * sizeof(*denoiser->power));
+        denoiser->nf = 0;
+        denoiser->acc_us -= FRAME_US;
+    }
+
+    /* --- Apply the gain of the bin at the center of the coefficients --- */
+
+    for (int k = 0; k < ns; k++)
+        x[k] *= denoiser->gains[(((2*k + 1) * FRAME_US) / dt_us) / 2];
+
+    return true;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Interface
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Create a denoiser, on the frames of an encoder
+ */
+struct lc3_denoiser *lc3_denoiser_create(struct lc3_encoder *encoder)
+{
+    if (!encoder || rnnoise_get_frame_size() + 1 != NUM_BINS)
+        return NULL;
+
+    struct lc3_denoiser *denoiser = malloc(sizeof(struct lc3_denoiser));
+    if (!denoiser)
+        return NULL;
+
+    *denoiser = (struct lc3_denoiser){
+        .encoder = encoder, .st = rnnoise_create(NULL) };
+
+    if (!denoiser->st) {
+        free(denoiser);
+        return NULL;
+    }
+
+    for (int j = 0; j < NUM_BINS; j++)
+        denoiser->gains[j] = 1;
+
+    lc3_encoder_set_spectrum_hook(encoder, denoise, denoiser);
+
+    return denoiser;
+}
+
+/**
+ * Destroy a denoiser
+ */
+void lc3_denoiser_destroy(struct lc3_denoiser *denoiser)
+{
+    if (!denoiser)
+        return;
+
+    lc3_encoder_set_spectrum_hook(denoiser->encoder, NULL, NULL);
+
+    rnnoise_destroy(denoiser->st);
+    free(denoiser);
+}
+
+/**
+ * Return the voice probability of the last frame
+ */
+float lc3_denoiser_vad(struct lc3_denoiser *denoiser)
+{
+    return denoiser ? denoiser->vad : -1;
+}
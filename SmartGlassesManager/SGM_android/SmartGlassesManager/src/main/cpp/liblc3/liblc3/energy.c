@@ -26,7 +26,12 @@
 bool lc3_energy_compute(
     enum lc3_dt dt, enum lc3_srate sr, const float *x, float *e)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     static const int n1_table[LC3_NUM_DT][LC3_NUM_SRATE] = {
+        [LC3_DT_2M5] = { 18, 38, 58, 58, 54 },
+        [LC3_DT_5M ] = { 38, 56, 46, 41, 38 },
         [LC3_DT_7M5] = { 56, 34, 27, 24, 22 },
         [LC3_DT_10M] = { 49, 28, 23, 20, 18 },
     };
@@ -46,7 +51,7 @@ bool lc3_energy_compute(
      * note that 7.5ms 8KHz frame has more bands than samples */
 
     int nb = LC3_MIN(LC3_NUM_BANDS, LC3_NS(dt, sr));
-    int iband_h = nb - 2*(2 - dt);
+    int iband_h = nb - (dt == LC3_DT_7M5 ? 4 : 2);
     const int *lim = lc3_band_lim[dt][sr];
 
     for (int i = lim[iband]; iband < nb; iband++) {
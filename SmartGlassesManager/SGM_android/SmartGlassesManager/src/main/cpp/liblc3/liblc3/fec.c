@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+#include <lc3_fec.h>
+
+#include "common.h"
+
+
+/**
+ * Check the size of frames
+ */
+static bool check_nbytes(int nbytes)
+{
+    return nbytes >= LC3_MIN_FRAME_BYTES && nbytes <= LC3_MAX_FRAME_BYTES;
+}
+
+/**
+ * Setup the encoding of packets
+ */
+int lc3_fec_setup_encoder(lc3_fec_encoder_t *fec,
+    int nbytes, int nbytes_fec, int delay)
+{
+    if (!fec || !check_nbytes(nbytes) || !check_nbytes(nbytes_fec) ||
+            delay < 1 || delay > LC3_FEC_MAX_DELAY)
+        return -1;
+
+    *fec = (lc3_fec_encoder_t){
+        .nbytes = nbytes, .nbytes_fec = nbytes_fec, .delay = delay };
+
+    return 0;
+}
+
+/**
+ * Encode a packet
+ */
+int lc3_fec_encode(lc3_fec_encoder_t *fec,
+    lc3_encoder_t encoder, enum lc3_pcm_format fmt,
+    const void *pcm, int stride, void *_out)
+{
+    uint8_t *out = _out;
+    int nbytes[2] = { fec->nbytes, fec->nbytes_fec };
+
+    if (lc3_encode_simulcast(encoder, fmt, pcm, stride, 2, nbytes, out) < 0)
+        return -1;
+
+    /* --- Exchange the redundant frame with the one of the frame
+     *     `delay` before, the oldest one kept --- */
+
+    uint8_t *p = out + fec->nbytes;
+    uint8_t *q = fec->fec[fec->idx];
+
+    for (int i = 0; i < fec->nbytes_fec; i++) {
+        uint8_t v = p[i];
+        p[i] = q[i], q[i] = v;
+    }
+
+    fec->idx = (fec->idx + 1) % fec->delay;
+
+    return 0;
+}
+
+/**
+ * Setup the decoding of packets
+ */
+int lc3_fec_setup_decoder(lc3_fec_decoder_t *fec,
+    int nbytes, int nbytes_fec, int delay)
+{
+    if (!fec || !check_nbytes(nbytes) || !check_nbytes(nbytes_fec) ||
+            delay < 1 || delay > LC3_FEC_MAX_DELAY)
+        return -1;
+
+    *fec = (lc3_fec_decoder_t){
+        .nbytes = nbytes, .nbytes_fec = nbytes_fec, .delay = delay };
+
+    return 0;
+}
+
+/**
+ * Decode the frame sent `delay` packets before
+ */
+int lc3_fec_decode(lc3_fec_decoder_t *fec,
+    lc3_decoder_t decoder, const void *_in,
+    enum lc3_pcm_format fmt, void *pcm, int stride)
+{
+    const uint8_t *in = _in;
+    uint8_t *frame = fec->frame[fec->idx];
+    bool *received = &fec->received[fec->idx];
+    int ret;
+
+    /* --- Decode the frame `delay` before, from its packet when received,
+     *     or from its redundant copy in this packet --- */
+
+    if (*received)
+        ret = lc3_decode(decoder, frame, fec->nbytes, fmt, pcm, stride);
+
+    else if (in && fec->nframes >= fec->delay) {
+        ret = lc3_decode(decoder,
+            in + fec->nbytes, fec->nbytes_fec, fmt, pcm, stride);
+        ret = ret == 0 ? 2 : ret;
+    }
+
+    else {
+        ret = lc3_decode(decoder, NULL, 0, fmt, pcm, stride);
+        ret = ret < 0 || fec->nframes >= fec->delay ? ret : 0;
+    }
+
+    if (ret < 0)
+        return -1;
+
+    /* --- Keep the frame of this packet, in place of the decoded one --- */
+
+    if ((*received = (in != NULL)))
+        memcpy(frame, in, fec->nbytes);
+
+    fec->idx = (fec->idx + 1) % fec->delay;
+    fec->nframes = LC3_MIN(fec->nframes + 1, fec->delay);
+
+    return ret;
+}
@@ -0,0 +1,279 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <lc3_frontend.h>
+#include <stdlib.h>
+
+#include "common.h"
+
+#include <speex_resampler.h>
+
+
+/**
+ * Size of the chunks of input samples, processed at once
+ * Maximum number of samples in a frame (10 ms at 48 KHz)
+ */
+
+#define CHUNK_SIZE  256
+#define FRAME_MAX   LC3_NS(LC3_DT_10M, LC3_SRATE_48K)
+
+
+/**
+ * Front end state
+ */
+
+struct lc3_frontend {
+    lc3_encoder_t encoder;
+    SpeexResamplerState *resampler;
+
+    int nch, ns;
+    int sr_hz, sr_in_hz;
+
+    int nf;
+    float x[CHUNK_SIZE];
+    float frame[FRAME_MAX];
+};
+
+
+/* ----------------------------------------------------------------------------
+ *  Downmix
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Downmix signed 16 bits input
+ * pcm, nch, n     Interleaved input, number of channels and samples
+ * x               Output `n` mono samples, in range -1 to 1
+ */
+static void downmix_s16(const void *_pcm, int nch, int n, float *x)
+{
+    const int16_t *pcm = _pcm;
+    const float scale = 1.f / (32768 * nch);
+
+    for (int i = 0; i < n; i++) {
+        int32_t sum = 0;
+        for (int ch = 0; ch < nch; ch++)
+            sum += *(pcm++);
+        x[i] = sum * scale;
+    }
+}
+
+/**
+ * Downmix signed 24 bits input
+ * pcm, nch, n     Interleaved input, number of channels and samples
+ * x               Output `n` mono samples, in range -1 to 1
+ */
+static void downmix_s24(const void *_pcm, int nch, int n, float *x)
+{
+    const int32_t *pcm = _pcm;
+    const float scale = 1.f / ((1 << 23) * nch);
+
+    for (int i = 0; i < n; i++) {
+        float sum = 0;
+        for (int ch = 0; ch < nch; ch++)
+            sum += *(pcm++);
+        x[i] = sum * scale;
+    }
+}
+
+/**
+ * Downmix signed 24 bits packed input
+ * pcm, nch, n     Interleaved input, number of channels and samples
+ * x               Output `n` mono samples, in range -1 to 1
+ */
+static void downmix_s24_3le(const void *_pcm, int nch, int n, float *x)
+{
+    const uint8_t *pcm = _pcm;
+    const float scale = 1.f / (2147483648.f * nch);
+
+    for (int i = 0; i < n; i++) {
+        float sum = 0;
+        for (int ch = 0; ch < nch; ch++, pcm += 3)
+            sum += (int32_t)( ((uint32_t)pcm[0] <<  8) |
+                              ((uint32_t)pcm[1] << 16) |
+                              ((uint32_t)pcm[2] << 24)  );
+        x[i] = sum * scale;
+    }
+}
+
+/**
+ * Downmix float input
+ * pcm, nch, n     Interleaved input, number of channels and samples
+ * x               Output `n` mono samples, in range -1 to 1
+ */
+static void downmix_float(const void *_pcm, int nch, int n, float *x)
+{
+    const float *pcm = _pcm;
+    const float scale = 1.f / nch;
+
+    for (int i = 0; i < n; i++) {
+        float sum = 0;
+        for (int ch = 0; ch < nch; ch++)
+            sum += *(pcm++);
+        x[i] = sum * scale;
+    }
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Interface
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Create a front end, and its encoder
+ */
+struct lc3_frontend *lc3_frontend_create(
+    int dt_us, int sr_hz, int sr_in_hz, int nch)
+{
+    unsigned encoder_size = lc3_encoder_size(dt_us, sr_hz);
+    if (!encoder_size || sr_in_hz <= 0 || nch <= 0)
+        return NULL;
+
+    struct lc3_frontend *frontend =
+        malloc(sizeof(struct lc3_frontend) + encoder_size);
+    if (!frontend)
+        return NULL;
+
+    *frontend = (struct lc3_frontend){
+        .encoder = lc3_setup_encoder(dt_us, sr_hz, 0, frontend + 1),
+        .nch = nch, .ns = lc3_frame_samples(dt_us, sr_hz),
+        .sr_hz = sr_hz, .sr_in_hz = sr_in_hz,
+    };
+
+    if (sr_in_hz != sr_hz) {
+        int err;
+
+        frontend->resampler = speex_resampler_init(
+            1, sr_in_hz, sr_hz, SPEEX_RESAMPLER_QUALITY_DEFAULT, &err);
+        if (!frontend->resampler) {
+            free(frontend);
+            return NULL;
+        }
+
+        speex_resampler_skip_zeros(frontend->resampler);
+    }
+
+    return frontend;
+}
+
+/**
+ * Destroy a front end
+ */
+void lc3_frontend_destroy(struct lc3_frontend *frontend)
+{
+    if (!frontend)
+        return;
+
+    if (frontend->resampler)
+        speex_resampler_destroy(frontend->resampler);
+
+    free(frontend);
+}
+
+/**
+ * Return the number of channels of the PCM input
+ */
+int lc3_frontend_channels(struct lc3_frontend *frontend)
+{
+    return frontend ? frontend->nch : -1;
+}
+
+/**
+ * Return the maximum number of frames produced by an encoding call
+ */
+int lc3_frontend_max_frames(struct lc3_frontend *frontend, int ns)
+{
+    if (!frontend || ns < 0)
+        return -1;
+
+    /* --- The resampler can be ahead of one sample --- */
+
+    int64_t n = ((int64_t)ns * frontend->sr_hz +
+        frontend->sr_in_hz - 1) / frontend->sr_in_hz;
+
+    return (frontend->nf + n + 1) / frontend->ns;
+}
+
+/**
+ * Encode PCM samples
+ */
+int lc3_frontend_encode(struct lc3_frontend *frontend,
+    enum lc3_pcm_format fmt, const void *pcm, int ns, int nbytes, void *out)
+{
+    static void (* const downmix[])(const void *, int, int, float *) = {
+        [LC3_PCM_FORMAT_S16    ] = downmix_s16,
+        [LC3_PCM_FORMAT_S24    ] = downmix_s24,
+        [LC3_PCM_FORMAT_S24_3LE] = downmix_s24_3le,
+        [LC3_PCM_FORMAT_FLOAT  ] = downmix_float,
+    };
+
+    static const int pcm_bytes[] = {
+        [LC3_PCM_FORMAT_S16    ] = sizeof(int16_t),
+        [LC3_PCM_FORMAT_S24    ] = sizeof(int32_t),
+        [LC3_PCM_FORMAT_S24_3LE] = 3,
+        [LC3_PCM_FORMAT_FLOAT  ] = sizeof(float),
+    };
+
+    /* --- Check parameters --- */
+
+    if (!frontend || !frontend->encoder || ns < 0
+            || nbytes < LC3_MIN_FRAME_BYTES || nbytes > LC3_MAX_FRAME_BYTES)
+        return -1;
+
+    /* --- Processing --- */
+
+    const uint8_t *p = pcm;
+    uint8_t *buffer = out;
+    int nframes = 0;
+
+    while (ns > 0) {
+        int n = LC3_MIN(ns, CHUNK_SIZE);
+        const float *x = frontend->x;
+
+        downmix[fmt](p, frontend->nch, n, frontend->x);
+        p += n * frontend->nch * pcm_bytes[fmt];
+        ns -= n;
+
+        while (n > 0) {
+            spx_uint32_t n_in = n;
+            spx_uint32_t n_out = frontend->ns - frontend->nf;
+            float *y = frontend->frame + frontend->nf;
+
+            if (frontend->resampler)
+                speex_resampler_process_float(
+                    frontend->resampler, 0, x, &n_in, y, &n_out);
+            else {
+                n_in = n_out = LC3_MIN(n_in, n_out);
+                memcpy(y, x, n_out * sizeof(*y));
+            }
+
+            x += n_in, n -= n_in;
+            frontend->nf += n_out;
+
+            if (frontend->nf < frontend->ns)
+                continue;
+
+            lc3_encode(frontend->encoder,
+                LC3_PCM_FORMAT_FLOAT, frontend->frame, 1, nbytes, buffer);
+
+            buffer += nbytes, nframes++;
+            frontend->nf = 0;
+        }
+    }
+
+    return nframes;
+}
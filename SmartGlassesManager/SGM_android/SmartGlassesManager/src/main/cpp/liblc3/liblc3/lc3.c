@@ -57,8 +57,11 @@ struct side_data {
  */
 static enum lc3_dt resolve_dt(int us)
 {
-    return us ==  7500 ? LC3_DT_7M5 :
-           us == 10000 ? LC3_DT_10M : LC3_NUM_DT;
+    if (!LC3_WITH_DT(us) || !LC3_CHECK_DT_US(us))
+        return LC3_NUM_DT;
+
+    return us ==  2500 ? LC3_DT_2M5 : us ==  5000 ? LC3_DT_5M  :
+           us ==  7500 ? LC3_DT_7M5 : us == 10000 ? LC3_DT_10M : LC3_NUM_DT;
 }
 
 /**
@@ -68,6 +71,9 @@ static enum lc3_dt resolve_dt(int us)
  */
 static enum lc3_srate resolve_sr(int hz)
 {
+    if (!LC3_WITH_SR(hz))
+        return LC3_NUM_SRATE;
+
     return hz ==  8000 ? LC3_SRATE_8K  : hz == 16000 ? LC3_SRATE_16K :
            hz == 24000 ? LC3_SRATE_24K : hz == 32000 ? LC3_SRATE_32K :
            hz == 48000 ? LC3_SRATE_48K : LC3_NUM_SRATE;
@@ -136,7 +142,7 @@ int lc3_delay_samples(int dt_us, int sr_hz)
     if (dt >= LC3_NUM_DT || sr >= LC3_NUM_SRATE)
         return -1;
 
-    return (dt == LC3_DT_7M5 ? 8 : 5) * (LC3_SRATE_KHZ(sr) / 2);
+    return 2 * LC3_ND(dt, sr) - LC3_NS(dt, sr);
 }
 
 
@@ -157,6 +163,9 @@ static void load_s16(
     enum lc3_dt dt = encoder->dt;
     enum lc3_srate sr = encoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     int16_t *xt = encoder->xt;
     float *xs = encoder->xs;
     int ns = LC3_NS(dt, sr);
@@ -178,6 +187,9 @@ static void load_s24(
     enum lc3_dt dt = encoder->dt;
     enum lc3_srate sr = encoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     int16_t *xt = encoder->xt;
     float *xs = encoder->xs;
     int ns = LC3_NS(dt, sr);
@@ -201,6 +213,9 @@ static void load_s24_3le(
     enum lc3_dt dt = encoder->dt;
     enum lc3_srate sr = encoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     int16_t *xt = encoder->xt;
     float *xs = encoder->xs;
     int ns = LC3_NS(dt, sr);
@@ -228,6 +243,9 @@ static void load_float(
     enum lc3_dt dt = encoder->dt;
     enum lc3_srate sr = encoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     int16_t *xt = encoder->xt;
     float *xs = encoder->xs;
     int ns = LC3_NS(dt, sr);
@@ -239,17 +257,26 @@ static void load_float(
 }
 
 /**
- * Frame Analysis
+ * Frame Analysis, independent of the size of the frame
  * encoder         Encoder state
- * nbytes          Size in bytes of the frame
- * side, xq        Return frame data
+ * side            Return the bandwidth and the LTPF data
+ * e               Return the energy estimation per band
+ * return          True when high energy detected near Nyquist frequency
+ *
+ * The temporal signal history is shifted, so the attack detection
+ * of the frame needs to be run before.
  */
-static void analyze(struct lc3_encoder *encoder,
-    int nbytes, struct side_data *side, uint16_t *xq)
+static bool analyze_common(struct lc3_encoder *encoder,
+    struct side_data *side, float *e)
 {
     enum lc3_dt dt = encoder->dt;
     enum lc3_srate sr = encoder->sr;
     enum lc3_srate sr_pcm = encoder->sr_pcm;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+    LC3_BIND_SR(sr_pcm);
+
     int ns = LC3_NS(dt, sr_pcm);
     int nt = LC3_NT(sr_pcm);
 
@@ -260,48 +287,107 @@ static void analyze(struct lc3_encoder *encoder,
 
     /* --- Temporal --- */
 
-    bool att = lc3_attdet_run(dt, sr_pcm, nbytes, &encoder->attdet, xt);
-
-    side->pitch_present =
+    side->pitch_present = encoder->complexity == LC3_COMPLEXITY_FULL &&
         lc3_ltpf_analyse(dt, sr_pcm, &encoder->ltpf, xt, &side->ltpf);
 
     memmove(xt - nt, xt + (ns-nt), nt * sizeof(*xt));
 
     /* --- Spectral --- */
 
-    float e[LC3_NUM_BANDS];
-
     lc3_mdct_forward(dt, sr_pcm, sr, xs, xd, xf);
 
     bool nn_flag = lc3_energy_compute(dt, sr, xf, e);
-    if (nn_flag)
+
+    if (encoder->spectrum_hook &&
+            encoder->spectrum_hook(encoder->spectrum_ctx, xf, e))
+        nn_flag = lc3_energy_compute(dt, sr, xf, e);
+
+    if (nn_flag || !side->pitch_present)
         lc3_ltpf_disable(&side->ltpf);
 
     side->bw = lc3_bwdet_run(dt, sr, e);
 
-    lc3_sns_analyze(dt, sr, e, att, &side->sns, xf, xf);
+    return nn_flag;
+}
+
+/**
+ * Spectral shaping of the frame (SNS and TNS)
+ * encoder         Encoder state
+ * nbytes          Size in bytes of the frame
+ * att, nn_flag    Attack and near Nyquist detection flags
+ * e               Energy estimation per band
+ * side            Frame data, return the SNS and TNS data
+ * x, y            Spectral coefficients, and shaped output (in place ok)
+ */
+static void analyze_shape(struct lc3_encoder *encoder,
+    int nbytes, bool att, bool nn_flag, const float *e,
+    struct side_data *side, const float *x, float *y)
+{
+    enum lc3_dt dt = encoder->dt;
+    enum lc3_srate sr = encoder->sr;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
+    lc3_sns_analyze(dt, sr, e, att, &side->sns, x, y);
+
+    lc3_tns_analyze(dt, side->bw,
+        nn_flag || encoder->complexity >= LC3_COMPLEXITY_LOW,
+        nbytes, &side->tns, y);
+}
+
+/**
+ * Frame Analysis
+ * encoder         Encoder state
+ * nbytes          Size in bytes of the frame
+ * side, xq        Return frame data
+ */
+static void analyze(struct lc3_encoder *encoder,
+    int nbytes, struct side_data *side, uint16_t *xq)
+{
+    enum lc3_dt dt = encoder->dt;
+    enum lc3_srate sr = encoder->sr;
+    enum lc3_srate sr_pcm = encoder->sr_pcm;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+    LC3_BIND_SR(sr_pcm);
+
+    float *xf = encoder->xs;
+    float e[LC3_NUM_BANDS];
 
-    lc3_tns_analyze(dt, side->bw, nn_flag, nbytes, &side->tns, xf);
+    bool att = lc3_attdet_run(dt, sr_pcm,
+        nbytes, &encoder->attdet[0], encoder->xt);
+
+    bool nn_flag = analyze_common(encoder, side, e);
+
+    analyze_shape(encoder, nbytes, att, nn_flag, e, side, xf, xf);
 
     lc3_spec_analyze(dt, sr,
         nbytes, side->pitch_present, &side->tns,
-        &encoder->spec, xf, xq, &side->spec);
+        encoder->complexity == LC3_COMPLEXITY_FULL,
+        &encoder->spec[0], xf, xq, &side->spec);
 }
 
 /**
  * Encode bitstream
  * encoder         Encoder state
  * side, xq        The frame data
+ * xf              Scaled spectral coefficients
  * nbytes          Target size of the frame (20 to 400)
  * buffer          Output bitstream buffer of `nbytes` size
  */
 static void encode(struct lc3_encoder *encoder,
-    const struct side_data *side, uint16_t *xq, int nbytes, void *buffer)
+    const struct side_data *side, uint16_t *xq, const float *xf,
+    int nbytes, void *buffer)
 {
     enum lc3_dt dt = encoder->dt;
     enum lc3_srate sr = encoder->sr;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     enum lc3_bandwidth bw = side->bw;
-    float *xf = encoder->xs;
 
     lc3_bits_t bits;
 
@@ -374,6 +460,42 @@ struct lc3_encoder *lc3_setup_encoder(
     return encoder;
 }
 
+/**
+ * Set the complexity of the encoder
+ */
+int lc3_encoder_set_complexity(
+    struct lc3_encoder *encoder, enum lc3_complexity complexity)
+{
+    if (!encoder || (unsigned)complexity > LC3_COMPLEXITY_LOW)
+        return -1;
+
+    /* --- The history of the pitch analysis is not maintained
+     *     while skipped, restart it from a clean state --- */
+
+    if (complexity == LC3_COMPLEXITY_FULL &&
+            encoder->complexity != LC3_COMPLEXITY_FULL)
+        memset(&encoder->ltpf, 0, sizeof(encoder->ltpf));
+
+    encoder->complexity = complexity;
+
+    return 0;
+}
+
+/**
+ * Set a spectral processing of the encoder
+ */
+int lc3_encoder_set_spectrum_hook(
+    struct lc3_encoder *encoder, lc3_spectrum_hook_t hook, void *ctx)
+{
+    if (!encoder)
+        return -1;
+
+    encoder->spectrum_hook = hook;
+    encoder->spectrum_ctx = hook ? ctx : NULL;
+
+    return 0;
+}
+
 /**
  * Encode a frame
  */
@@ -402,7 +524,97 @@ int lc3_encode(struct lc3_encoder *encoder, enum lc3_pcm_format fmt,
 
     analyze(encoder, nbytes, &side, xq);
 
-    encode(encoder, &side, xq, nbytes, out);
+    encode(encoder, &side, xq, encoder->xs, nbytes, out);
+
+    return 0;
+}
+
+/**
+ * Encode a frame at different sizes
+ */
+int lc3_encode_simulcast(struct lc3_encoder *encoder,
+    enum lc3_pcm_format fmt, const void *pcm, int stride,
+    int nstreams, const int *nbytes, void *out)
+{
+    static void (* const load[])(struct lc3_encoder *, const void *, int) = {
+        [LC3_PCM_FORMAT_S16    ] = load_s16,
+        [LC3_PCM_FORMAT_S24    ] = load_s24,
+        [LC3_PCM_FORMAT_S24_3LE] = load_s24_3le,
+        [LC3_PCM_FORMAT_FLOAT  ] = load_float,
+    };
+
+    /* --- Check parameters --- */
+
+    if (!encoder || nstreams < 1 || nstreams > LC3_MAX_SIMULCAST)
+        return -1;
+
+    for (int i = 0; i < nstreams; i++)
+        if (nbytes[i] < LC3_MIN_FRAME_BYTES ||
+            nbytes[i] > LC3_MAX_FRAME_BYTES)
+            return -1;
+
+    /* --- Analysis common to the streams --- */
+
+    enum lc3_dt dt = encoder->dt;
+    enum lc3_srate sr = encoder->sr;
+    enum lc3_srate sr_pcm = encoder->sr_pcm;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+    LC3_BIND_SR(sr_pcm);
+
+    int ne = LC3_NE(dt, sr);
+    float *xf = encoder->xs;
+    float e[LC3_NUM_BANDS];
+
+    struct side_data side;
+    int shape[LC3_MAX_SIMULCAST], offset[LC3_MAX_SIMULCAST];
+
+    load[fmt](encoder, pcm, stride);
+
+    for (int i = 0; i < nstreams; i++) {
+        offset[i] = i > 0 ? offset[i-1] + nbytes[i-1] : 0;
+
+        bool att = lc3_attdet_run(dt, sr_pcm,
+            nbytes[i], &encoder->attdet[i], encoder->xt);
+
+        shape[i] = att | lc3_tns_get_lpc_weighting(dt, nbytes[i]) << 1;
+    }
+
+    bool nn_flag = analyze_common(encoder, &side, e);
+
+    /* --- The spectral shaping depends only on the attack detection
+     *     and the LPC weighting of TNS. Run it once for the streams
+     *     sharing these, before quantizing and coding each one --- */
+
+    uint16_t xq[ne];
+    float xshape[ne], xw[ne];
+
+    for (int i = 0; i < nstreams; i++) {
+        int j;
+
+        for (j = 0; shape[j] != shape[i]; j++);
+        if (j < i)
+            continue;
+
+        analyze_shape(encoder,
+            nbytes[i], shape[i] & 1, nn_flag, e, &side, xf, xshape);
+
+        for ( ; j < nstreams; j++) {
+            if (shape[j] != shape[i])
+                continue;
+
+            memcpy(xw, xshape, ne * sizeof(*xw));
+
+            lc3_spec_analyze(dt, sr,
+                nbytes[j], side.pitch_present, &side.tns,
+                encoder->complexity == LC3_COMPLEXITY_FULL,
+                &encoder->spec[j], xw, xq, &side.spec);
+
+            encode(encoder, &side, xq, xw,
+                nbytes[j], (uint8_t *)out + offset[j]);
+        }
+    }
 
     return 0;
 }
@@ -425,6 +637,9 @@ static void store_s16(
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     float *xs = decoder->xs;
     int ns = LC3_NS(dt, sr);
 
@@ -447,6 +662,9 @@ static void store_s24(
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     float *xs = decoder->xs;
     int ns = LC3_NS(dt, sr);
 
@@ -470,6 +688,9 @@ static void store_s24_3le(
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     float *xs = decoder->xs;
     int ns = LC3_NS(dt, sr);
 
@@ -497,6 +718,9 @@ static void store_float(
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     float *xs = decoder->xs;
     int ns = LC3_NS(dt, sr);
 
@@ -506,6 +730,63 @@ static void store_float(
     }
 }
 
+/**
+ * Output PCM Samples to float 32 bits, without clipping
+ * decoder         Decoder state
+ * pcm, stride     Output PCM samples, and count between two consecutives
+ */
+static void store_float_unclipped(
+    struct lc3_decoder *decoder, void *_pcm, int stride)
+{
+    float *pcm = _pcm;
+
+    enum lc3_dt dt = decoder->dt;
+    enum lc3_srate sr = decoder->sr_pcm;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
+    float *xs = decoder->xs;
+    int ns = LC3_NS(dt, sr);
+
+    for ( ; ns > 0; ns--, xs++, pcm += stride)
+        *pcm = *xs * 0x1p-15f;
+}
+
+/**
+ * Decode the side data, preceding the spectral coefficients
+ * bits            Bitstream context
+ * dt, sr, nbytes  Duration, samplerate and size of the frame
+ * side            Return the side data
+ * return          0: Ok  < 0: Bitsream error detected
+ */
+static int decode_side(lc3_bits_t *bits,
+    enum lc3_dt dt, enum lc3_srate sr, int nbytes, struct side_data *side)
+{
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
+    int ret = 0;
+
+    if ((ret = lc3_bwdet_get_bw(bits, sr, &side->bw)) < 0)
+        return ret;
+
+    if ((ret = lc3_spec_get_side(bits, dt, sr, &side->spec)) < 0)
+        return ret;
+
+    lc3_tns_get_data(bits, dt, side->bw, nbytes, &side->tns);
+
+    side->pitch_present = lc3_get_bit(bits);
+
+    if ((ret = lc3_sns_get_data(bits, &side->sns)) < 0)
+        return ret;
+
+    if (side->pitch_present)
+        lc3_ltpf_get_data(bits, &side->ltpf);
+
+    return 0;
+}
+
 /**
  * Decode bitstream
  * decoder         Decoder state
@@ -519,6 +800,9 @@ static int decode(struct lc3_decoder *decoder,
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     float *xf = decoder->xs;
     int ns = LC3_NS(dt, sr);
     int ne = LC3_NE(dt, sr);
@@ -528,22 +812,9 @@ static int decode(struct lc3_decoder *decoder,
 
     lc3_setup_bits(&bits, LC3_BITS_MODE_READ, (void *)data, nbytes);
 
-    if ((ret = lc3_bwdet_get_bw(&bits, sr, &side->bw)) < 0)
-        return ret;
-
-    if ((ret = lc3_spec_get_side(&bits, dt, sr, &side->spec)) < 0)
+    if ((ret = decode_side(&bits, dt, sr, nbytes, side)) < 0)
         return ret;
 
-    lc3_tns_get_data(&bits, dt, side->bw, nbytes, &side->tns);
-
-    side->pitch_present = lc3_get_bit(&bits);
-
-    if ((ret = lc3_sns_get_data(&bits, &side->sns)) < 0)
-        return ret;
-
-    if (side->pitch_present)
-        lc3_ltpf_get_data(&bits, &side->ltpf);
-
     if ((ret = lc3_spec_decode(&bits, dt, sr,
                     side->bw, nbytes, &side->spec, xf)) < 0)
         return ret;
@@ -554,47 +825,78 @@ static int decode(struct lc3_decoder *decoder,
 }
 
 /**
- * Frame synthesis
+ * Spectrum synthesis
  * decoder         Decoder state
  * side            Frame data, NULL performs PLC
- * nbytes          Size in bytes of the frame
+ * return          The spectrum, as input of the inverse MDCT
  */
-static void synthesize(struct lc3_decoder *decoder,
-    const struct side_data *side, int nbytes)
+static float *synthesize_spectrum(
+    struct lc3_decoder *decoder, const struct side_data *side)
 {
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr = decoder->sr;
     enum lc3_srate sr_pcm = decoder->sr_pcm;
 
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+    LC3_BIND_SR(sr_pcm);
+
     float *xf = decoder->xs;
     int ns = LC3_NS(dt, sr_pcm);
     int ne = LC3_NE(dt, sr);
 
     float *xg = decoder->xg;
-    float *xd = decoder->xd;
-    float *xs = xf;
 
     if (side) {
         enum lc3_bandwidth bw = side->bw;
 
         lc3_plc_suspend(&decoder->plc);
 
+        int ne_bw = decoder->mode == LC3_DECODER_MODE_ASR ?
+            LC3_NE(dt, bw) : LC3_NE(dt, sr);
+
         lc3_tns_synthesize(dt, bw, &side->tns, xf);
 
-        lc3_sns_synthesize(dt, sr, &side->sns, xf, xg);
+        lc3_sns_synthesize(dt, sr, &side->sns, ne_bw, xf, xg);
 
-        lc3_mdct_inverse(dt, sr_pcm, sr, xg, xd, xs);
+        return xg;
 
     } else {
         lc3_plc_synthesize(dt, sr, &decoder->plc, xg, xf);
 
         memset(xf + ne, 0, (ns - ne) * sizeof(float));
 
-        lc3_mdct_inverse(dt, sr_pcm, sr, xf, xd, xs);
+        return xf;
     }
+}
+
+/**
+ * Frame synthesis
+ * decoder         Decoder state
+ * side            Frame data, NULL performs PLC
+ * nbytes          Size in bytes of the frame
+ */
+static void synthesize(struct lc3_decoder *decoder,
+    const struct side_data *side, int nbytes)
+{
+    enum lc3_dt dt = decoder->dt;
+    enum lc3_srate sr = decoder->sr;
+    enum lc3_srate sr_pcm = decoder->sr_pcm;
 
-    lc3_ltpf_synthesize(dt, sr_pcm, nbytes, &decoder->ltpf,
-        side && side->pitch_present ? &side->ltpf : NULL, decoder->xh, xs);
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+    LC3_BIND_SR(sr_pcm);
+
+    float *xd = decoder->xd;
+    float *xs = decoder->xs;
+
+    float *x = synthesize_spectrum(decoder, side);
+
+    lc3_mdct_inverse(dt, sr_pcm, sr, x, xd, xs);
+
+    if (decoder->mode != LC3_DECODER_MODE_ASR)
+        lc3_ltpf_synthesize(dt, sr_pcm, nbytes, &decoder->ltpf,
+            side && side->pitch_present ? &side->ltpf : NULL, decoder->xh, xs);
 }
 
 /**
@@ -605,6 +907,10 @@ static void complete(struct lc3_decoder *decoder)
 {
     enum lc3_dt dt = decoder->dt;
     enum lc3_srate sr_pcm = decoder->sr_pcm;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr_pcm);
+
     int nh = LC3_NH(dt, sr_pcm);
     int ns = LC3_NS(dt, sr_pcm);
 
@@ -664,6 +970,27 @@ struct lc3_decoder *lc3_setup_decoder(
     return decoder;
 }
 
+/**
+ * Set the mode of the decoder
+ */
+int lc3_decoder_set_mode(
+    struct lc3_decoder *decoder, enum lc3_decoder_mode mode)
+{
+    if (!decoder || (unsigned)mode > LC3_DECODER_MODE_ASR)
+        return -1;
+
+    /* --- The postfilter restarts from a clean state,
+     *     its state has not been tracked --- */
+
+    if (mode == LC3_DECODER_MODE_PLAYBACK &&
+            decoder->mode != LC3_DECODER_MODE_PLAYBACK)
+        memset(&decoder->ltpf, 0, sizeof(decoder->ltpf));
+
+    decoder->mode = mode;
+
+    return 0;
+}
+
 /**
  * Decode a frame
  */
@@ -694,9 +1021,113 @@ int lc3_decode(struct lc3_decoder *decoder, const void *in, int nbytes,
 
     synthesize(decoder, ret ? NULL : &side, nbytes);
 
-    store[fmt](decoder, pcm, stride);
+    if (fmt == LC3_PCM_FORMAT_FLOAT && decoder->mode == LC3_DECODER_MODE_ASR)
+        store_float_unclipped(decoder, pcm, stride);
+    else
+        store[fmt](decoder, pcm, stride);
 
     complete(decoder);
 
     return ret;
 }
+
+/**
+ * Return the number of bands of the energies decoded
+ */
+int lc3_energy_bands(int dt_us, int sr_hz)
+{
+    enum lc3_dt dt = resolve_dt(dt_us);
+    enum lc3_srate sr = resolve_sr(sr_hz);
+
+    if (dt >= LC3_NUM_DT || sr >= LC3_NUM_SRATE)
+        return -1;
+
+    return LC3_MIN(LC3_NUM_BANDS, LC3_NS(dt, sr));
+}
+
+/**
+ * Decode the energies of the bands of a frame
+ */
+int lc3_decode_energies(struct lc3_decoder *decoder,
+    const void *in, int nbytes, float *e)
+{
+    /* --- Check parameters --- */
+
+    if (!decoder || !e)
+        return -1;
+
+    if (in && (nbytes < LC3_MIN_FRAME_BYTES ||
+               nbytes > LC3_MAX_FRAME_BYTES   ))
+        return -1;
+
+    /* --- Processing --- */
+
+    enum lc3_dt dt = decoder->dt;
+    enum lc3_srate sr = decoder->sr;
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
+    int nb = LC3_MIN(LC3_NUM_BANDS, LC3_NS(dt, sr));
+
+    struct side_data side;
+    float eb[LC3_NUM_BANDS];
+
+    int ret = !in || (decode(decoder, in, nbytes, &side) < 0);
+
+    float *x = synthesize_spectrum(decoder, ret ? NULL : &side);
+
+    lc3_energy_compute(dt, sr, x, eb);
+
+    for (int i = 0; i < nb; i++)
+        e[i] = 10 * fast_log10f(fmaxf(eb[i], 1e-10f));
+
+    return ret;
+}
+
+/**
+ * Estimate the level of a frame, from its side data
+ */
+int lc3_frame_level(int dt_us, int sr_hz,
+    const void *in, int nbytes, float *level, bool *pitch)
+{
+    enum lc3_dt dt = resolve_dt(dt_us);
+    enum lc3_srate sr = resolve_sr(sr_hz);
+
+    /* --- Check parameters --- */
+
+    if (dt >= LC3_NUM_DT || sr >= LC3_NUM_SRATE || !in || !level || !pitch)
+        return -1;
+
+    if (nbytes < LC3_MIN_FRAME_BYTES ||
+        nbytes > LC3_MAX_FRAME_BYTES   )
+        return -1;
+
+    /* --- Processing --- */
+
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
+    struct side_data side;
+    float x[LC3_MAX_NE];
+    int ne = LC3_NE(dt, sr);
+
+    lc3_bits_t bits;
+    lc3_setup_bits(&bits, LC3_BITS_MODE_READ, (void *)in, nbytes);
+
+    if (decode_side(&bits, dt, sr, nbytes, &side) < 0)
+        return -1;
+
+    lc3_spec_estimate(&bits, dt, sr, side.bw, nbytes, &side.spec, x);
+
+    lc3_sns_synthesize(dt, sr, &side.sns, ne, x, x);
+
+    float e = 0;
+    for (int i = 0; i < ne; i++)
+        e += x[i] * x[i];
+
+    *level = 10 * fast_log10f(fmaxf(e / LC3_NS(dt, sr), 1e-10f)) - 90.3f;
+    *pitch = side.pitch_present;
+
+    return 0;
+}
@@ -20,6 +20,7 @@
 #include "tables.h"
 
 #include "ltpf_neon.h"
+#include "ltpf_wasm.h"
 #include "ltpf_arm.h"
 
 
@@ -612,6 +613,16 @@ bool lc3_ltpf_analyse(
     enum lc3_dt dt, enum lc3_srate sr, struct lc3_ltpf_analysis *ltpf,
     const int16_t *x, struct lc3_ltpf_data *data)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
+    /* --- No pitch tracking on 2.5ms and 5ms frames --- */
+
+    if (dt < LC3_DT_7M5) {
+        data->active = false;
+        return false;
+    }
+
     /* --- Resampling to 12.8 KHz --- */
 
     int z_12k8 = sizeof(ltpf->x_12k8) / sizeof(*ltpf->x_12k8);
@@ -791,6 +802,9 @@ void lc3_ltpf_synthesize(enum lc3_dt dt, enum lc3_srate sr, int nbytes,
     lc3_ltpf_synthesis_t *ltpf, const lc3_ltpf_data_t *data,
     const float *xh, float *x)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     int nh = LC3_NH(dt, sr);
     int dt_us = LC3_DT_US(dt);
 
@@ -820,7 +834,7 @@ void lc3_ltpf_synthesize(enum lc3_dt dt, enum lc3_srate sr, int nbytes,
     /* --- Transition handling --- */
 
     int ns = LC3_NS(dt, sr);
-    int nt = ns / (3 + dt);
+    int nt = ns / (1 + dt);
     float x0[w];
 
     if (active)
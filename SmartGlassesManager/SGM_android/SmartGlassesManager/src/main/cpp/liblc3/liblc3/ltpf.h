@@ -53,6 +53,7 @@ typedef struct lc3_ltpf_data {
  * data            Return bitstream data
  * return          True when pitch present, False otherwise
  *
+ * The pitch is not searched on 2.5ms and 5ms frames.
  * The `x` vector is aligned on 32 bits
  * The number of previous samples `d` accessed on `x` is :
  *   d: { 10, 20, 30, 40, 60 } - 1 for samplerates from 8KHz to 48KHz
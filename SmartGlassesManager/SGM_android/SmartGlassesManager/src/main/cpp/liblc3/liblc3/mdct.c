@@ -20,6 +20,7 @@
 #include "tables.h"
 
 #include "mdct_neon.h"
+#include "mdct_wasm.h"
 
 
 /* ----------------------------------------------------------------------------
@@ -160,7 +161,8 @@ LC3_HOT static inline void fft_bf2(
 /**
  * Perform FFT
  * x, y0, y1       Input, and 2 scratch buffers of size `n`
- * n               Number of points 30, 40, 60, 80, 90, 120, 160, 180, 240
+ * n               Number of points 10, 20, 30, 40, 60, 80, 90, 120, 160,
+ *                 180, 240
  * return          The buffer `y0` or `y1` that hold the result
  *
  * Input `x` can be the same as the `y0` second scratch buffer
@@ -175,7 +177,7 @@ static struct lc3_complex *fft(const struct lc3_complex *x, int n,
      *
      *   n = 5^1 * 3^n3 * 2^n2
      *
-     *   for n = 40, 80, 160        n3 = 0, n2 = [3..5]
+     *   for n = 10, 20, 40, 80, 160   n3 = 0, n2 = [1..5]
      *       n = 30, 60, 120, 240   n3 = 1, n2 = [1..4]
      *       n = 90, 180            n3 = 2, n2 = [1..2]
      *
@@ -415,6 +417,10 @@ LC3_HOT static void imdct_window(enum lc3_dt dt, enum lc3_srate sr,
 void lc3_mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
     enum lc3_srate sr_dst, const float *x, float *d, float *y)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+    LC3_BIND_SR(sr_dst);
+
     const struct lc3_mdct_rot_def *rot = lc3_mdct_rot[dt][sr];
     int nf = LC3_NS(dt, sr_dst);
     int ns = LC3_NS(dt, sr);
@@ -436,6 +442,10 @@ void lc3_mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
 void lc3_mdct_inverse(enum lc3_dt dt, enum lc3_srate sr,
     enum lc3_srate sr_src, const float *x, float *d, float *y)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+    LC3_BIND_SR(sr_src);
+
     const struct lc3_mdct_rot_def *rot = lc3_mdct_rot[dt][sr];
     int nf = LC3_NS(dt, sr_src);
     int ns = LC3_NS(dt, sr);
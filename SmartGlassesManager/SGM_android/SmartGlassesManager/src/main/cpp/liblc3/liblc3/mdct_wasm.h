@@ -0,0 +1,309 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __wasm_simd128__ || defined(TEST_WASM)
+
+#ifndef TEST_WASM
+#include <wasm_simd128.h>
+#endif /* TEST_WASM */
+
+
+/**
+ * Multiply-accumulate helpers, SIMD128 does not provide fused operations
+ */
+
+#define wasm_f32x4_mla(a, b, c) \
+    wasm_f32x4_add(a, wasm_f32x4_mul(b, c))
+
+#define wasm_f32x4_mls(a, b, c) \
+    wasm_f32x4_sub(a, wasm_f32x4_mul(b, c))
+
+/**
+ * Return the complex values rotated by Pi/2, (-im, re) for each one
+ */
+static inline v128_t wasm_c32x2_rot(v128_t x)
+{
+    return wasm_i32x4_shuffle(wasm_f32x4_neg(x), x, 1, 4, 3, 6);
+}
+
+
+/**
+ * FFT 5 Points
+ * The number of interleaved transform `n` assumed to be even
+ */
+#ifndef fft_5
+
+LC3_HOT static inline void wasm_fft_5(
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    const v128_t sin1 = wasm_f32x4_make(
+        0.9510565163, -0.9510565163, 0.9510565163, -0.9510565163);
+    const v128_t sin2 = wasm_f32x4_make(
+        0.5877852523, -0.5877852523, 0.5877852523, -0.5877852523);
+    const v128_t cos1 = wasm_f32x4_splat( 0.3090169944);
+    const v128_t cos2 = wasm_f32x4_splat(-0.8090169944);
+
+    for (int i = 0; i < n; i += 2, x += 2, y += 10) {
+
+        v128_t y0, y1, y2, y3, y4;
+
+        v128_t x0 = wasm_v128_load( (float *)(x + 0*n) );
+        v128_t x1 = wasm_v128_load( (float *)(x + 1*n) );
+        v128_t x2 = wasm_v128_load( (float *)(x + 2*n) );
+        v128_t x3 = wasm_v128_load( (float *)(x + 3*n) );
+        v128_t x4 = wasm_v128_load( (float *)(x + 4*n) );
+
+        v128_t s14 = wasm_f32x4_add(x1, x4);
+        v128_t s23 = wasm_f32x4_add(x2, x3);
+
+        v128_t d14 = wasm_f32x4_sub(x1, x4);
+        v128_t d23 = wasm_f32x4_sub(x2, x3);
+
+        d14 = wasm_i32x4_shuffle(d14, d14, 1, 0, 3, 2);
+        d23 = wasm_i32x4_shuffle(d23, d23, 1, 0, 3, 2);
+
+        y0 = wasm_f32x4_add( x0, wasm_f32x4_add(s14, s23) );
+
+        y4 = wasm_f32x4_mla( x0, s14, cos1 );
+        y4 = wasm_f32x4_mla( y4, s23, cos2 );
+
+        y1 = wasm_f32x4_mla( y4, d14, sin1 );
+        y1 = wasm_f32x4_mla( y1, d23, sin2 );
+
+        y4 = wasm_f32x4_mls( y4, d14, sin1 );
+        y4 = wasm_f32x4_mls( y4, d23, sin2 );
+
+        y3 = wasm_f32x4_mla( x0, s14, cos2 );
+        y3 = wasm_f32x4_mla( y3, s23, cos1 );
+
+        y2 = wasm_f32x4_mla( y3, d14, sin2 );
+        y2 = wasm_f32x4_mls( y2, d23, sin1 );
+
+        y3 = wasm_f32x4_mls( y3, d14, sin2 );
+        y3 = wasm_f32x4_mla( y3, d23, sin1 );
+
+        wasm_v128_store64_lane( (float *)(y + 0), y0, 0 );
+        wasm_v128_store64_lane( (float *)(y + 1), y1, 0 );
+        wasm_v128_store64_lane( (float *)(y + 2), y2, 0 );
+        wasm_v128_store64_lane( (float *)(y + 3), y3, 0 );
+        wasm_v128_store64_lane( (float *)(y + 4), y4, 0 );
+
+        wasm_v128_store64_lane( (float *)(y + 5), y0, 1 );
+        wasm_v128_store64_lane( (float *)(y + 6), y1, 1 );
+        wasm_v128_store64_lane( (float *)(y + 7), y2, 1 );
+        wasm_v128_store64_lane( (float *)(y + 8), y3, 1 );
+        wasm_v128_store64_lane( (float *)(y + 9), y4, 1 );
+    }
+}
+
+#ifndef TEST_WASM
+#define fft_5 wasm_fft_5
+#endif
+
+#endif /* fft_5 */
+
+/**
+ * FFT Butterfly 3 Points
+ */
+#ifndef fft_bf3
+
+LC3_HOT static inline void wasm_fft_bf3(
+    const struct lc3_fft_bf3_twiddles *twiddles,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n3 = twiddles->n3;
+    const struct lc3_complex (*w0_ptr)[2] = twiddles->t;
+    const struct lc3_complex (*w1_ptr)[2] = w0_ptr + n3;
+    const struct lc3_complex (*w2_ptr)[2] = w1_ptr + n3;
+
+    const struct lc3_complex *x0_ptr = x;
+    const struct lc3_complex *x1_ptr = x0_ptr + n*n3;
+    const struct lc3_complex *x2_ptr = x1_ptr + n*n3;
+
+    struct lc3_complex *y0_ptr = y;
+    struct lc3_complex *y1_ptr = y0_ptr + n3;
+    struct lc3_complex *y2_ptr = y1_ptr + n3;
+
+    for (int j, i = 0; i < n; i++,
+            y0_ptr += 3*n3, y1_ptr += 3*n3, y2_ptr += 3*n3) {
+
+        /* --- Process by pair --- */
+
+        for (j = 0; j < (n3 >> 1); j++,
+                x0_ptr += 2, x1_ptr += 2, x2_ptr += 2) {
+
+            v128_t x0 = wasm_v128_load( (float *)x0_ptr );
+            v128_t x1 = wasm_v128_load( (float *)x1_ptr );
+            v128_t x2 = wasm_v128_load( (float *)x2_ptr );
+
+            v128_t x1r = wasm_c32x2_rot(x1);
+            v128_t x2r = wasm_c32x2_rot(x2);
+
+            v128_t wa, wb, yn;
+
+            wa = wasm_v128_load( (float *)(w0_ptr + 2*j + 0) );
+            wb = wasm_v128_load( (float *)(w0_ptr + 2*j + 1) );
+
+            yn = wasm_f32x4_mla( x0, x1 , wasm_i32x4_shuffle(wa, wb, 0, 0, 4, 4) );
+            yn = wasm_f32x4_mla( yn, x1r, wasm_i32x4_shuffle(wa, wb, 1, 1, 5, 5) );
+            yn = wasm_f32x4_mla( yn, x2 , wasm_i32x4_shuffle(wa, wb, 2, 2, 6, 6) );
+            yn = wasm_f32x4_mla( yn, x2r, wasm_i32x4_shuffle(wa, wb, 3, 3, 7, 7) );
+            wasm_v128_store( (float *)(y0_ptr + 2*j), yn );
+
+            wa = wasm_v128_load( (float *)(w1_ptr + 2*j + 0) );
+            wb = wasm_v128_load( (float *)(w1_ptr + 2*j + 1) );
+
+            yn = wasm_f32x4_mla( x0, x1 , wasm_i32x4_shuffle(wa, wb, 0, 0, 4, 4) );
+            yn = wasm_f32x4_mla( yn, x1r, wasm_i32x4_shuffle(wa, wb, 1, 1, 5, 5) );
+            yn = wasm_f32x4_mla( yn, x2 , wasm_i32x4_shuffle(wa, wb, 2, 2, 6, 6) );
+            yn = wasm_f32x4_mla( yn, x2r, wasm_i32x4_shuffle(wa, wb, 3, 3, 7, 7) );
+            wasm_v128_store( (float *)(y1_ptr + 2*j), yn );
+
+            wa = wasm_v128_load( (float *)(w2_ptr + 2*j + 0) );
+            wb = wasm_v128_load( (float *)(w2_ptr + 2*j + 1) );
+
+            yn = wasm_f32x4_mla( x0, x1 , wasm_i32x4_shuffle(wa, wb, 0, 0, 4, 4) );
+            yn = wasm_f32x4_mla( yn, x1r, wasm_i32x4_shuffle(wa, wb, 1, 1, 5, 5) );
+            yn = wasm_f32x4_mla( yn, x2 , wasm_i32x4_shuffle(wa, wb, 2, 2, 6, 6) );
+            yn = wasm_f32x4_mla( yn, x2r, wasm_i32x4_shuffle(wa, wb, 3, 3, 7, 7) );
+            wasm_v128_store( (float *)(y2_ptr + 2*j), yn );
+        }
+
+        /* --- Last iteration --- */
+
+        if (n3 & 1) {
+
+            v128_t x0 = wasm_v128_load64_zero( (float *)(x0_ptr++) );
+            v128_t x1 = wasm_v128_load64_zero( (float *)(x1_ptr++) );
+            v128_t x2 = wasm_v128_load64_zero( (float *)(x2_ptr++) );
+
+            v128_t x1r = wasm_c32x2_rot(x1);
+            v128_t x2r = wasm_c32x2_rot(x2);
+
+            v128_t wn, yn;
+
+            wn = wasm_v128_load( (float *)(w0_ptr + 2*j) );
+
+            yn = wasm_f32x4_mla( x0, x1 , wasm_i32x4_shuffle(wn, wn, 0, 0, 0, 0) );
+            yn = wasm_f32x4_mla( yn, x1r, wasm_i32x4_shuffle(wn, wn, 1, 1, 1, 1) );
+            yn = wasm_f32x4_mla( yn, x2 , wasm_i32x4_shuffle(wn, wn, 2, 2, 2, 2) );
+            yn = wasm_f32x4_mla( yn, x2r, wasm_i32x4_shuffle(wn, wn, 3, 3, 3, 3) );
+            wasm_v128_store64_lane( (float *)(y0_ptr + 2*j), yn, 0 );
+
+            wn = wasm_v128_load( (float *)(w1_ptr + 2*j) );
+
+            yn = wasm_f32x4_mla( x0, x1 , wasm_i32x4_shuffle(wn, wn, 0, 0, 0, 0) );
+            yn = wasm_f32x4_mla( yn, x1r, wasm_i32x4_shuffle(wn, wn, 1, 1, 1, 1) );
+            yn = wasm_f32x4_mla( yn, x2 , wasm_i32x4_shuffle(wn, wn, 2, 2, 2, 2) );
+            yn = wasm_f32x4_mla( yn, x2r, wasm_i32x4_shuffle(wn, wn, 3, 3, 3, 3) );
+            wasm_v128_store64_lane( (float *)(y1_ptr + 2*j), yn, 0 );
+
+            wn = wasm_v128_load( (float *)(w2_ptr + 2*j) );
+
+            yn = wasm_f32x4_mla( x0, x1 , wasm_i32x4_shuffle(wn, wn, 0, 0, 0, 0) );
+            yn = wasm_f32x4_mla( yn, x1r, wasm_i32x4_shuffle(wn, wn, 1, 1, 1, 1) );
+            yn = wasm_f32x4_mla( yn, x2 , wasm_i32x4_shuffle(wn, wn, 2, 2, 2, 2) );
+            yn = wasm_f32x4_mla( yn, x2r, wasm_i32x4_shuffle(wn, wn, 3, 3, 3, 3) );
+            wasm_v128_store64_lane( (float *)(y2_ptr + 2*j), yn, 0 );
+        }
+
+    }
+}
+
+#ifndef TEST_WASM
+#define fft_bf3 wasm_fft_bf3
+#endif
+
+#endif /* fft_bf3 */
+
+/**
+ * FFT Butterfly 2 Points
+ */
+#ifndef fft_bf2
+
+LC3_HOT static inline void wasm_fft_bf2(
+    const struct lc3_fft_bf2_twiddles *twiddles,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n2 = twiddles->n2;
+    const struct lc3_complex *w_ptr = twiddles->t;
+
+    const struct lc3_complex *x0_ptr = x;
+    const struct lc3_complex *x1_ptr = x0_ptr + n*n2;
+
+    struct lc3_complex *y0_ptr = y;
+    struct lc3_complex *y1_ptr = y0_ptr + n2;
+
+    for (int j, i = 0; i < n; i++, y0_ptr += 2*n2, y1_ptr += 2*n2) {
+
+        /* --- Process by pair --- */
+
+        for (j = 0; j < (n2 >> 1); j++, x0_ptr += 2, x1_ptr += 2) {
+
+            v128_t x0 = wasm_v128_load( (float *)x0_ptr );
+            v128_t x1 = wasm_v128_load( (float *)x1_ptr );
+            v128_t y0, y1;
+
+            v128_t x1r = wasm_c32x2_rot(x1);
+
+            v128_t w = wasm_v128_load( (float *)(w_ptr + 2*j) );
+            v128_t w_re = wasm_i32x4_shuffle(w, w, 0, 0, 2, 2);
+            v128_t w_im = wasm_i32x4_shuffle(w, w, 1, 1, 3, 3);
+
+            y0 = wasm_f32x4_mla( x0, x1 , w_re );
+            y0 = wasm_f32x4_mla( y0, x1r, w_im );
+            wasm_v128_store( (float *)(y0_ptr + 2*j), y0 );
+
+            y1 = wasm_f32x4_mls( x0, x1 , w_re );
+            y1 = wasm_f32x4_mls( y1, x1r, w_im );
+            wasm_v128_store( (float *)(y1_ptr + 2*j), y1 );
+        }
+
+        /* --- Last iteration --- */
+
+        if (n2 & 1) {
+
+            v128_t x0 = wasm_v128_load64_zero( (float *)(x0_ptr++) );
+            v128_t x1 = wasm_v128_load64_zero( (float *)(x1_ptr++) );
+            v128_t y0, y1;
+
+            v128_t x1r = wasm_c32x2_rot(x1);
+
+            v128_t w = wasm_v128_load64_zero( (float *)(w_ptr + 2*j) );
+            v128_t w_re = wasm_i32x4_shuffle(w, w, 0, 0, 2, 2);
+            v128_t w_im = wasm_i32x4_shuffle(w, w, 1, 1, 3, 3);
+
+            y0 = wasm_f32x4_mla( x0, x1 , w_re );
+            y0 = wasm_f32x4_mla( y0, x1r, w_im );
+            wasm_v128_store64_lane( (float *)(y0_ptr + 2*j), y0, 0 );
+
+            y1 = wasm_f32x4_mls( x0, x1 , w_re );
+            y1 = wasm_f32x4_mls( y1, x1r, w_im );
+            wasm_v128_store64_lane( (float *)(y1_ptr + 2*j), y1, 0 );
+        }
+    }
+}
+
+#ifndef TEST_WASM
+#define fft_bf2 wasm_fft_bf2
+#endif
+
+#endif /* fft_bf2 */
+
+#endif /* __wasm_simd128__ */
@@ -0,0 +1,205 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+#include <lc3_packet.h>
+
+#include "common.h"
+
+
+/**
+ * Header fields
+ */
+
+#define HEADER_VSIZE  0x80
+#define HEADER_COUNT  0x7f
+
+
+/**
+ * Number of packets in a row found late, resynchronizing on the stream
+ */
+
+#define RESYNC_DROPS  4
+
+
+/* ----------------------------------------------------------------------------
+ *  Packetizer
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Setup the packetizer
+ */
+int lc3_packetizer_setup(lc3_packetizer_t *pk, int size, bool vsize)
+{
+    if (!pk || size < LC3_PACKET_HEADER_BYTES + vsize + LC3_MIN_FRAME_BYTES)
+        return -1;
+
+    *pk = (lc3_packetizer_t){ .size = size, .vsize = vsize };
+
+    return 0;
+}
+
+/**
+ * Start a packet
+ */
+void lc3_packetizer_begin(lc3_packetizer_t *pk, void *packet)
+{
+    pk->packet = packet;
+    pk->count = 0;
+    pk->len = LC3_PACKET_HEADER_BYTES;
+}
+
+/**
+ * Add a frame to the packet
+ */
+void *lc3_packetizer_add(lc3_packetizer_t *pk, int nbytes)
+{
+    if (nbytes < LC3_MIN_FRAME_BYTES || nbytes > LC3_MAX_FRAME_BYTES ||
+            (pk->vsize && nbytes > LC3_PACKET_MAX_FRAME_BYTES) ||
+            (!pk->vsize && pk->count > 0 && nbytes != pk->nbytes))
+        return NULL;
+
+    if (pk->count >= LC3_PACKET_MAX_FRAMES ||
+            pk->len + pk->vsize + nbytes > pk->size)
+        return NULL;
+
+    uint8_t *p = pk->packet + pk->len;
+
+    if (pk->vsize)
+        *(p++) = nbytes;
+
+    pk->len += pk->vsize + nbytes;
+    pk->nbytes = nbytes;
+    pk->count++;
+
+    return p;
+}
+
+/**
+ * Complete the packet
+ */
+int lc3_packetizer_end(lc3_packetizer_t *pk)
+{
+    if (!pk->count)
+        return 0;
+
+    pk->packet[0] = pk->seq & 0xff;
+    pk->packet[1] = (pk->vsize ? HEADER_VSIZE : 0) | pk->count;
+    pk->seq += pk->count;
+
+    return pk->len;
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Depacketizer
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Setup the depacketizer
+ */
+int lc3_depacketizer_setup(lc3_depacketizer_t *dp)
+{
+    if (!dp)
+        return -1;
+
+    *dp = (lc3_depacketizer_t){ .started = false };
+
+    return 0;
+}
+
+/**
+ * Put a received packet
+ */
+int lc3_depacketizer_put(lc3_depacketizer_t *dp, const void *_packet, int size)
+{
+    const uint8_t *packet = _packet;
+
+    if (!packet || size < LC3_PACKET_HEADER_BYTES)
+        return -1;
+
+    unsigned seq = packet[0];
+    bool vsize = packet[1] & HEADER_VSIZE;
+    int count = packet[1] & HEADER_COUNT;
+    int len = size - LC3_PACKET_HEADER_BYTES;
+
+    /* --- Check the layout of the frames --- */
+
+    if (count <= 0)
+        return -1;
+
+    if (vsize) {
+        const uint8_t *p = packet + LC3_PACKET_HEADER_BYTES;
+        const uint8_t *end = packet + size;
+
+        for (int i = 0; i < count; i++, p += 1 + *p)
+            if (end - p < 1 || *p < LC3_MIN_FRAME_BYTES || end - p < 1 + *p)
+                return -1;
+
+        if (p != end)
+            return -1;
+    }
+    else if (len % count || len / count < LC3_MIN_FRAME_BYTES ||
+                            len / count > LC3_MAX_FRAME_BYTES)
+        return -1;
+
+    /* --- Locate in the sequence, dropping late and duplicated packets,
+     *     on the half range of the sequence behind the expected one --- */
+
+    int nlost = dp->started ? (seq - dp->seq) & 0xff : 0;
+
+    if (nlost >= 128 && ++dp->ndrops < RESYNC_DROPS)
+        return -1;
+
+    if (nlost >= 128)
+        nlost = 0;
+
+    *dp = (lc3_depacketizer_t){
+        .started = true, .seq = (seq + count) & 0xff,
+        .nlost = nlost,
+        .p = packet + LC3_PACKET_HEADER_BYTES,
+        .count = count, .nbytes = vsize ? 0 : len / count, .vsize = vsize,
+    };
+
+    return nlost;
+}
+
+/**
+ * Take the next frame
+ */
+int lc3_depacketizer_get(lc3_depacketizer_t *dp, const void **frame)
+{
+    if (dp->nlost > 0) {
+        dp->nlost--;
+        *frame = NULL;
+        return 0;
+    }
+
+    if (dp->count <= 0) {
+        *frame = NULL;
+        return -1;
+    }
+
+    int nbytes = dp->vsize ? *(dp->p++) : dp->nbytes;
+
+    *frame = dp->p;
+    dp->p += nbytes;
+    dp->count--;
+
+    return nbytes;
+}
@@ -43,6 +43,9 @@ void lc3_plc_suspend(struct lc3_plc_state *plc)
 void lc3_plc_synthesize(enum lc3_dt dt, enum lc3_srate sr,
     struct lc3_plc_state *plc, const float *x, float *y)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     uint16_t seed = plc->seed;
     float alpha = plc->alpha;
     int ne = LC3_NE(dt, sr);
@@ -0,0 +1,221 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <lc3_ratectl.h>
+
+#include "common.h"
+
+
+/**
+ * Sizes of frames selectable by the controller
+ */
+
+static const uint8_t frame_bytes[] = {
+     20,  26,  30,  40,  50,  60,  80, 100, 120, 150, 180, 220, 255 };
+
+#define NUM_STEPS  (int)(sizeof(frame_bytes) / sizeof(*frame_bytes))
+
+
+/**
+ * Thresholds, durations in us
+ *   QUEUE_LOW/HIGH      Queue depth allowing a raise, or congestion
+ *   LOSS_LOW/HIGH       Smoothed loss ratio allowing a raise, or congestion
+ *   HOLDOFF_MIN/MAX     Range of the delay before raising
+ *   HEADROOM            Fraction of the measured throughput usable
+ */
+
+#define QUEUE_LOW     20000
+#define QUEUE_HIGH    80000
+
+#define LOSS_LOW      0.01f
+#define LOSS_HIGH     0.05f
+
+#define HOLDOFF_MIN   500000
+#define HOLDOFF_MAX  8000000
+
+#define HEADROOM      0.8f
+
+
+/**
+ * Return the step of the largest size, lower or equal to a budget
+ * nbytes          Budget in bytes
+ * return          Step, -1 when lower than all the sizes
+ */
+static int step_below(int nbytes)
+{
+    int step = -1;
+
+    while (step + 1 < NUM_STEPS && frame_bytes[step + 1] <= nbytes)
+        step++;
+
+    return step;
+}
+
+/**
+ * Return the step of the smallest size, greater or equal to a budget
+ * nbytes          Budget in bytes
+ * return          Step, `NUM_STEPS` when greater than all the sizes
+ */
+static int step_above(int nbytes)
+{
+    int step = NUM_STEPS;
+
+    while (step - 1 >= 0 && frame_bytes[step - 1] >= nbytes)
+        step--;
+
+    return step;
+}
+
+/**
+ * Setup the rate controller
+ */
+int lc3_ratectl_setup(lc3_ratectl_t *ctl,
+    int dt_us, int min_bytes, int max_bytes)
+{
+    if (!ctl || !LC3_CHECK_DT_US(dt_us)
+             || min_bytes < LC3_MIN_FRAME_BYTES
+             || max_bytes > LC3_RATECTL_MAX_FRAME_BYTES
+             || min_bytes > max_bytes)
+        return -1;
+
+    int min_step = step_above(min_bytes);
+    int max_step = step_below(max_bytes);
+    if (min_step > max_step)
+        return -1;
+
+    *ctl = (lc3_ratectl_t){
+        .dt_us = dt_us,
+        .min_step = min_step, .max_step = max_step,
+        .step = min_step,
+        .holdoff = HOLDOFF_MIN / dt_us,
+    };
+
+    return 0;
+}
+
+/**
+ * Report feedback of the link
+ */
+void lc3_ratectl_update(lc3_ratectl_t *ctl,
+    const struct lc3_ratectl_link *link)
+{
+    int dt_us = ctl->dt_us;
+
+    /* --- Smooth the loss ratio --- */
+
+    int nsent = link->sent + link->lost;
+    if (nsent > 0)
+        ctl->loss += ((float)link->lost / nsent - ctl->loss) / 4;
+
+    /* --- Size allowed by the throughput --- */
+
+    int budget_step = ctl->max_step;
+
+    if (link->throughput > 0) {
+        int budget = (int)(HEADROOM * link->throughput * dt_us / 8e6f)
+            - LC3_RATECTL_HEADER_BYTES;
+
+        budget_step = LC3_CLIP(step_below(budget),
+            ctl->min_step, ctl->max_step);
+    }
+
+    /* --- Congestion, lower immediately and double the hold-off --- */
+
+    bool congested = link->queue * dt_us >= QUEUE_HIGH ||
+        ctl->loss > LOSS_HIGH || ctl->step > budget_step;
+
+    if (congested && !ctl->congested)
+        ctl->holdoff = LC3_MIN(2 * ctl->holdoff, HOLDOFF_MAX / dt_us);
+
+    ctl->congested = congested;
+
+    if (congested) {
+        ctl->step = LC3_MAX(LC3_MIN(ctl->step - 1, budget_step),
+            ctl->min_step);
+
+        ctl->nframes = 0;
+        return;
+    }
+
+    /* --- Stable link, raise of one step after the hold-off --- */
+
+    bool stable = link->queue * dt_us <= QUEUE_LOW &&
+        ctl->loss < LOSS_LOW;
+
+    if (!stable) {
+        ctl->nframes = 0;
+        return;
+    }
+
+    if (ctl->nframes < ctl->holdoff || ctl->step >= budget_step)
+        return;
+
+    ctl->step++;
+    ctl->nframes = 0;
+    ctl->holdoff = LC3_MAX(ctl->holdoff / 2, HOLDOFF_MIN / dt_us);
+}
+
+/**
+ * Return the size selected for the next frame
+ */
+int lc3_ratectl_nbytes(const lc3_ratectl_t *ctl)
+{
+    return frame_bytes[ctl->step];
+}
+
+/**
+ * Encode a frame, with its in-band header
+ */
+int lc3_ratectl_encode(lc3_ratectl_t *ctl,
+    lc3_encoder_t encoder, enum lc3_pcm_format fmt,
+    const void *pcm, int stride, void *_out)
+{
+    uint8_t *out = _out;
+    int nbytes = lc3_ratectl_nbytes(ctl);
+
+    if (lc3_encode(encoder, fmt, pcm, stride,
+            nbytes, out + LC3_RATECTL_HEADER_BYTES) < 0)
+        return -1;
+
+    out[0] = nbytes;
+    ctl->nframes++;
+
+    return LC3_RATECTL_HEADER_BYTES + nbytes;
+}
+
+/**
+ * Decode a frame, prefixed by its in-band header
+ */
+int lc3_ratectl_decode(lc3_decoder_t decoder, const void *_in, int size,
+    enum lc3_pcm_format fmt, void *pcm, int stride)
+{
+    const uint8_t *in = _in;
+    int nbytes = size >= LC3_RATECTL_HEADER_BYTES ? in[0] : 0;
+
+    if (nbytes < LC3_MIN_FRAME_BYTES ||
+            LC3_RATECTL_HEADER_BYTES + nbytes > size) {
+        lc3_decode(decoder, NULL, 0, fmt, pcm, stride);
+        return -1;
+    }
+
+    if (lc3_decode(decoder, in + LC3_RATECTL_HEADER_BYTES, nbytes,
+            fmt, pcm, stride) < 0)
+        return -1;
+
+    return LC3_RATECTL_HEADER_BYTES + nbytes;
+}
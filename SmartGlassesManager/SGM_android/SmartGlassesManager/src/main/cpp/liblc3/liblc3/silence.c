@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+
+#include <lc3_silence.h>
+
+#include "common.h"
+
+
+/**
+ * Thresholds, levels in dB and durations in us
+ *   LEVEL_MIN           Level always considered as silence
+ *   LEVEL_MAX           Level above all frames, marking an empty window
+ *   MARGIN              Level above the floor, detecting speech
+ *   MARGIN_PITCH        Level above the floor, on voiced frames
+ *   WINDOW              Duration of a sub-window of the floor tracking
+ *   HANGOVER            Hold of the speech state
+ */
+
+#define LEVEL_MIN    -65.f
+#define LEVEL_MAX    100.f
+#define MARGIN         9.f
+#define MARGIN_PITCH   3.f
+#define WINDOW       400000
+#define HANGOVER     300000
+
+
+/**
+ * Setup the silence detector
+ */
+int lc3_silence_setup(lc3_silence_t *det, int dt_us, int sr_hz)
+{
+    if (!det || !LC3_CHECK_DT_US(dt_us) || !LC3_CHECK_SR_HZ(sr_hz))
+        return -1;
+
+    *det = (lc3_silence_t){
+        .dt_us = dt_us, .sr_hz = sr_hz,
+        .level = LEVEL_MAX, .floor = LEVEL_MAX,
+        .speech = true,
+        .cur_min = LEVEL_MAX,
+    };
+
+    for (int i = 0; i < LC3_SILENCE_NUM_WINDOWS; i++)
+        det->win_min[i] = LEVEL_MAX;
+
+    return 0;
+}
+
+/**
+ * Classify a frame
+ */
+int lc3_silence_detect(lc3_silence_t *det, const void *in, int nbytes)
+{
+    int dt_us = det->dt_us;
+    float level;
+    bool pitch;
+
+    if (!in || lc3_frame_level(dt_us, det->sr_hz,
+                    in, nbytes, &level, &pitch) < 0)
+        return !det->speech;
+
+    det->level = level;
+    det->pitch = pitch;
+
+    /* --- Track the noise floor, as the minimum over the sub-windows --- */
+
+    det->cur_min = LC3_MIN(det->cur_min, level);
+
+    if (++det->cur_frames >= WINDOW / dt_us) {
+        det->win_min[det->win_idx] = det->cur_min;
+        det->win_idx = (det->win_idx + 1) % LC3_SILENCE_NUM_WINDOWS;
+
+        det->cur_min = LEVEL_MAX;
+        det->cur_frames = 0;
+    }
+
+    float noise = det->cur_min;
+    for (int i = 0; i < LC3_SILENCE_NUM_WINDOWS; i++)
+        noise = LC3_MIN(noise, det->win_min[i]);
+
+    det->floor = noise;
+
+    if (det->win_min[0] >= LEVEL_MAX)
+        return 0;
+
+    /* --- Speech detection, with hangover --- */
+
+    float margin = pitch ? MARGIN_PITCH : MARGIN;
+
+    if (level > LC3_MAX(det->floor + margin, LEVEL_MIN)) {
+        det->speech = true;
+        det->hangover = HANGOVER / dt_us;
+    }
+    else if (det->hangover > 0)
+        det->hangover--;
+    else
+        det->speech = false;
+
+    return !det->speech;
+}
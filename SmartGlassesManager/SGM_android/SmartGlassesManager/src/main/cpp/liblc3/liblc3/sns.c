@@ -19,6 +19,9 @@
 #include "sns.h"
 #include "tables.h"
 
+#include "sns_neon.h"
+#include "sns_wasm.h"
+
 
 /* ----------------------------------------------------------------------------
  *  DCT-16
@@ -252,15 +255,22 @@ LC3_HOT static void compute_scale_factors(
 
     float e[LC3_NUM_BANDS];
 
-    /* --- Copy and padding --- */
+    /* --- Copy and padding ---
+     * Less than 32 bands are found on 2.5ms frames, they are repeated */
 
     int nb = LC3_MIN(lc3_band_lim[dt][sr][LC3_NUM_BANDS], LC3_NUM_BANDS);
     int n2 = LC3_NUM_BANDS - nb;
 
-    for (int i2 = 0; i2 < n2; i2++)
-        e[2*i2 + 0] = e[2*i2 + 1] = eb[i2];
+    if (nb < LC3_NUM_BANDS / 2) {
+        for (int i = 0; i < LC3_NUM_BANDS; i++)
+            e[i] = eb[(i * nb) / LC3_NUM_BANDS];
 
-    memcpy(e + 2*n2, eb + n2, (nb - n2) * sizeof(float));
+    } else {
+        for (int i2 = 0; i2 < n2; i2++)
+            e[2*i2 + 0] = e[2*i2 + 1] = eb[i2];
+
+        memcpy(e + 2*n2, eb + n2, (nb - n2) * sizeof(float));
+    }
 
     /* --- Smoothing, pre-emphasis and logarithm --- */
 
@@ -391,6 +401,7 @@ LC3_HOT static void normalize(const int *c, float *cn)
  * start, end      Current number of pulses, limit to reach
  * corr, energy    Correlation (x,y) and y energy, updated at output
  */
+#ifndef add_pulse
 LC3_HOT static void add_pulse(const float *x, int *y, int n,
     int start, int end, float *corr, float *energy)
 {
@@ -412,6 +423,33 @@ LC3_HOT static void add_pulse(const float *x, int *y, int n,
         y[nbest]++;
     }
 }
+#endif /* add_pulse */
+
+/**
+ * Sub-procedure of `quantize()`, mean square errors of the candidates
+ * x               Transformed residual
+ * cn              The 4 normalized pulse configurations candidates
+ * mse             Output errors, by shape and gain indexes
+ */
+#ifndef compute_mse
+LC3_HOT static void compute_mse(
+    const float *x, float (*cn)[16], float (*mse)[8])
+{
+    for (int ic = 0; ic < 4; ic++) {
+        const struct lc3_sns_vq_gains *cgains = lc3_sns_vq_gains + ic;
+
+        for (int ig = 0; ig < cgains->count; ig++) {
+            float g = cgains->v[ig];
+            float m = 0;
+
+            for (int i = 0; i < 16; i++)
+                m += (x[i] - g * cn[ic][i]) * (x[i] - g * cn[ic][i]);
+
+            mse[ic][ig] = m;
+        }
+    }
+}
+#endif /* compute_mse */
 
 /**
  * Quantization of codebooks residual
@@ -506,6 +544,9 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
     /* --- Determe shape & gain index ---
      * Search the Mean Square Error, within (shape, gain) combinations */
 
+    float mse[4][8];
+    compute_mse(x, cn, mse);
+
     float mse_min = INFINITY;
     *shape_idx = *gain_idx = 0;
 
@@ -515,15 +556,9 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
         int cgain_idx = 0;
 
         for (int ig = 0; ig < cgains->count; ig++) {
-            float g = cgains->v[ig];
-
-            float mse = 0;
-            for (int i = 0; i < 16; i++)
-                mse += (x[i] - g * cn[ic][i]) * (x[i] - g * cn[ic][i]);
-
-            if (mse < cmse_min) {
+            if (mse[ic][ig] < cmse_min) {
                 cgain_idx = ig,
-                cmse_min = mse;
+                cmse_min = mse[ic][ig];
             }
         }
 
@@ -670,13 +705,14 @@ static void deenumerate(int shape,
  * dt, sr          Duration and samplerate of the frame
  * scf_q           Quantized scale factors
  * inv             True on inverse shaping, False otherwise
+ * n               Number of coefficients shaped, the following are cleared
  * x               Spectral coefficients
  * y               Return shapped coefficients
  *
  * `x` and `y` can be the same buffer
  */
 LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
-    const float *scf_q, bool inv, const float *x, float *y)
+    const float *scf_q, bool inv, int n, const float *x, float *y)
 {
     /* --- Interpolate scale factors --- */
 
@@ -697,22 +733,37 @@ LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
     int nb = LC3_MIN(lc3_band_lim[dt][sr][LC3_NUM_BANDS], LC3_NUM_BANDS);
     int n2 = LC3_NUM_BANDS - nb;
 
-    for (int i2 = 0; i2 < n2; i2++)
-        scf[i2] = 0.5f * (scf[2*i2] + scf[2*i2+1]);
+    if (nb < LC3_NUM_BANDS / 2) {
+        for (int ib = 0, i = 0; ib < nb; ib++) {
+            int i0 = i, ie = ((ib+1) * LC3_NUM_BANDS + nb-1) / nb;
+
+            float s = scf[i++];
+            while (i < ie)
+                s += scf[i++];
 
-    if (n2 > 0)
-        memmove(scf + n2, scf + 2*n2, (nb - n2) * sizeof(float));
+            scf[ib] = s / (ie - i0);
+        }
+
+    } else {
+        for (int i2 = 0; i2 < n2; i2++)
+            scf[i2] = 0.5f * (scf[2*i2] + scf[2*i2+1]);
+
+        if (n2 > 0)
+            memmove(scf + n2, scf + 2*n2, (nb - n2) * sizeof(float));
+    }
 
     /* --- Spectral shaping --- */
 
     const int *lim = lc3_band_lim[dt][sr];
 
-    for (int i = 0, ib = 0; ib < nb; ib++) {
+    for (int i = 0, ib = 0; i < n; ib++) {
         float g_sns = fast_exp2f(-scf[ib]);
 
-        for ( ; i < lim[ib+1]; i++)
+        for (int ie = LC3_MIN(lim[ib+1], n); i < ie; i++)
             y[i] = x[i] * g_sns;
     }
+
+    memset(y + n, 0, (lim[nb] - n) * sizeof(*y));
 }
 
 
@@ -727,6 +778,9 @@ void lc3_sns_analyze(enum lc3_dt dt, enum lc3_srate sr,
     const float *eb, bool att, struct lc3_sns_data *data,
     const float *x, float *y)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     /* Processing steps :
      * - Determine 16 scale factors from bands energy estimation
      * - Get codebooks indexes that match thoses scale factors
@@ -750,15 +804,18 @@ void lc3_sns_analyze(enum lc3_dt dt, enum lc3_srate sr,
     enumerate(data->shape, c[data->shape],
         &data->idx_a, &data->ls_a, &data->idx_b, &data->ls_b);
 
-    spectral_shaping(dt, sr, scf, false, x, y);
+    spectral_shaping(dt, sr, scf, false, LC3_NE(dt, sr), x, y);
 }
 
 /**
  * SNS synthesis
  */
 void lc3_sns_synthesize(enum lc3_dt dt, enum lc3_srate sr,
-    const lc3_sns_data_t *data, const float *x, float *y)
+    const lc3_sns_data_t *data, int n, const float *x, float *y)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     float scf[16], cn[16];
     int c[16];
 
@@ -769,7 +826,7 @@ void lc3_sns_synthesize(enum lc3_dt dt, enum lc3_srate sr,
 
     unquantize(data->lfcb, data->hfcb, cn, data->shape, data->gain, scf);
 
-    spectral_shaping(dt, sr, scf, true, x, y);
+    spectral_shaping(dt, sr, scf, true, n, x, y);
 }
 
 /**
@@ -91,13 +91,14 @@ int lc3_sns_get_data(lc3_bits_t *bits, lc3_sns_data_t *data);
  * SNS synthesis
  * dt, sr          Duration and samplerate of the frame
  * data            Bitstream data
+ * n               Number of coefficients shaped, the following are cleared
  * x               Spectral coefficients
  * y               Return shapped coefficients
  *
  * `x` and `y` can be the same buffer
  */
 void lc3_sns_synthesize(enum lc3_dt dt, enum lc3_srate sr,
-    const lc3_sns_data_t *data, const float *x, float *y);
+    const lc3_sns_data_t *data, int n, const float *x, float *y);
 
 
 #endif /* __LC3_SNS_H */
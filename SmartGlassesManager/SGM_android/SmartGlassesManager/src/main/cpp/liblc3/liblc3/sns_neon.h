@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Sub-procedure of `quantize()`, add unit pulse
+ */
+#ifndef add_pulse
+
+LC3_HOT static void neon_add_pulse(const float *x, int *y, int n,
+    int start, int end, float *corr, float *energy)
+{
+    /* --- Copy to full vectors, the lanes above `n` are masked --- */
+
+    float alignas(16) xv[16] = { 0 };
+    int32_t alignas(16) yv[16] = { 0 };
+
+    memcpy(xv, x, n * sizeof(*x));
+    memcpy(yv, y, n * sizeof(*y));
+
+    uint64_t mask_n = n < 16 ? (UINT64_C(1) << (4*n)) - 1 : UINT64_MAX;
+
+    for (int k = start; k < end; k++) {
+        float alignas(16) c2[16], e[16];
+
+        for (int i = 0; i < 16; i += 4) {
+            float32x4_t cx = vaddq_f32(vdupq_n_f32(*corr), vld1q_f32(xv + i));
+            int32x4_t y2 = vshlq_n_s32(vld1q_s32(yv + i), 1);
+
+            vst1q_f32(c2 + i, vmulq_f32(cx, cx));
+            vst1q_f32(e + i, vaddq_f32(vaddq_f32(
+                vdupq_n_f32(*energy), vcvtq_f32_s32(y2)), vdupq_n_f32(1)));
+        }
+
+        /* --- The serial search keeps the first coefficient beating the
+         *     current best one. Test them all at once, and jump to the
+         *     first one after the current best, until none remains.
+         *     The result of the comparisons are gathered as a nibble
+         *     by lane, in 64 bits. --- */
+
+        int nbest = 0;
+
+        for (uint64_t mask = mask_n & ~UINT64_C(0xf); mask; ) {
+            float best_c2 = c2[nbest], best_e = e[nbest];
+            uint32x4_t gt[4];
+
+            for (int i = 0; i < 4; i++)
+                gt[i] = vcgtq_f32(vmulq_n_f32(vld1q_f32(c2 + 4*i), best_e),
+                                  vmulq_n_f32(vld1q_f32(e  + 4*i), best_c2));
+
+            uint8x16_t gt8 = vcombine_u8(
+                vmovn_u16(vcombine_u16(vmovn_u32(gt[0]), vmovn_u32(gt[1]))),
+                vmovn_u16(vcombine_u16(vmovn_u32(gt[2]), vmovn_u32(gt[3]))) );
+
+            uint64_t beats = mask & vget_lane_u64(vreinterpret_u64_u8(
+                vshrn_n_u16(vreinterpretq_u16_u8(gt8), 4)), 0);
+
+            if (!beats)
+                break;
+
+            nbest = __builtin_ctzll(beats) >> 2;
+            mask = nbest < 15 ? mask & (UINT64_MAX << (4*nbest + 4)) : 0;
+        }
+
+        *corr += xv[nbest];
+        *energy += 2*yv[nbest] + 1;
+        yv[nbest]++;
+    }
+
+    memcpy(y, yv, n * sizeof(*y));
+}
+
+#ifndef TEST_NEON
+#define add_pulse neon_add_pulse
+#endif
+
+#endif /* add_pulse */
+
+/**
+ * Sub-procedure of `quantize()`, mean square errors of the candidates
+ */
+#ifndef compute_mse
+
+LC3_HOT static void neon_compute_mse(
+    const float *x, float (*cn)[16], float (*mse)[8])
+{
+    /* --- The gains are taken by lanes, the 2 gains
+     *     of shape 0 are duplicated --- */
+
+    const float *g0 = lc3_sns_vq_gains[0].v;
+    const float *g1 = lc3_sns_vq_gains[1].v;
+    const float *g2 = lc3_sns_vq_gains[2].v;
+    const float *g3 = lc3_sns_vq_gains[3].v;
+
+    float32x4_t g[5] = {
+        vcombine_f32(vld1_f32(g0), vld1_f32(g0)),
+        vld1q_f32(g1), vld1q_f32(g2), vld1q_f32(g3), vld1q_f32(g3 + 4) };
+
+    float32x4_t m[5];
+    for (int j = 0; j < 5; j++)
+        m[j] = vdupq_n_f32(0);
+
+    for (int i = 0; i < 16; i++) {
+        float32x4_t xi = vdupq_n_f32(x[i]);
+        float32x4_t d;
+
+        for (int j = 0; j < 5; j++) {
+            d = vsubq_f32(xi, vmulq_n_f32(g[j], cn[LC3_MIN(j, 3)][i]));
+            m[j] = vaddq_f32(m[j], vmulq_f32(d, d));
+        }
+    }
+
+    vst1q_f32(mse[0], m[0]);
+    vst1q_f32(mse[1], m[1]);
+    vst1q_f32(mse[2], m[2]);
+    vst1q_f32(mse[3] + 0, m[3]);
+    vst1q_f32(mse[3] + 4, m[4]);
+}
+
+#ifndef TEST_NEON
+#define compute_mse neon_compute_mse
+#endif
+
+#endif /* compute_mse */
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
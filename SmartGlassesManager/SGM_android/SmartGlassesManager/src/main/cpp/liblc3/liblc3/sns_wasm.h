@@ -0,0 +1,146 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __wasm_simd128__ || defined(TEST_WASM)
+
+#ifndef TEST_WASM
+#include <wasm_simd128.h>
+#endif /* TEST_WASM */
+
+
+/**
+ * Sub-procedure of `quantize()`, add unit pulse
+ */
+#ifndef add_pulse
+
+LC3_HOT static void wasm_add_pulse(const float *x, int *y, int n,
+    int start, int end, float *corr, float *energy)
+{
+    /* --- Copy to full vectors, the lanes above `n` are masked --- */
+
+    float alignas(16) xv[16] = { 0 };
+    int32_t alignas(16) yv[16] = { 0 };
+
+    memcpy(xv, x, n * sizeof(*x));
+    memcpy(yv, y, n * sizeof(*y));
+
+    unsigned mask_n = (1u << n) - 1;
+
+    for (int k = start; k < end; k++) {
+        float alignas(16) c2[16], e[16];
+
+        for (int i = 0; i < 16; i += 4) {
+            v128_t cx = wasm_f32x4_add(
+                wasm_f32x4_splat(*corr), wasm_v128_load(xv + i));
+            v128_t y2 = wasm_i32x4_shl(wasm_v128_load(yv + i), 1);
+
+            wasm_v128_store(c2 + i, wasm_f32x4_mul(cx, cx));
+            wasm_v128_store(e + i, wasm_f32x4_add(wasm_f32x4_add(
+                wasm_f32x4_splat(*energy), wasm_f32x4_convert_i32x4(y2)),
+                wasm_f32x4_splat(1)));
+        }
+
+        /* --- The serial search keeps the first coefficient beating the
+         *     current best one. Test them all at once, and jump to the
+         *     first one after the current best, until none remains --- */
+
+        int nbest = 0;
+
+        for (unsigned mask = mask_n & ~1u; mask; ) {
+            v128_t best_c2 = wasm_f32x4_splat(c2[nbest]);
+            v128_t best_e = wasm_f32x4_splat(e[nbest]);
+            unsigned beats = 0;
+
+            for (int i = 0; i < 4; i++)
+                beats |= wasm_i32x4_bitmask(wasm_f32x4_gt(
+                    wasm_f32x4_mul(wasm_v128_load(c2 + 4*i), best_e),
+                    wasm_f32x4_mul(wasm_v128_load(e  + 4*i), best_c2) ))
+                        << (4*i);
+
+            if (!(beats &= mask))
+                break;
+
+            nbest = __builtin_ctz(beats);
+            mask &= ~0u << nbest << 1;
+        }
+
+        *corr += xv[nbest];
+        *energy += 2*yv[nbest] + 1;
+        yv[nbest]++;
+    }
+
+    memcpy(y, yv, n * sizeof(*y));
+}
+
+#ifndef TEST_WASM
+#define add_pulse wasm_add_pulse
+#endif
+
+#endif /* add_pulse */
+
+/**
+ * Sub-procedure of `quantize()`, mean square errors of the candidates
+ */
+#ifndef compute_mse
+
+LC3_HOT static void wasm_compute_mse(
+    const float *x, float (*cn)[16], float (*mse)[8])
+{
+    /* --- The gains are taken by lanes, the 2 gains
+     *     of shape 0 are duplicated --- */
+
+    const float *g0 = lc3_sns_vq_gains[0].v;
+    const float *g1 = lc3_sns_vq_gains[1].v;
+    const float *g2 = lc3_sns_vq_gains[2].v;
+    const float *g3 = lc3_sns_vq_gains[3].v;
+
+    v128_t g[5] = {
+        wasm_f32x4_make(g0[0], g0[1], g0[0], g0[1]),
+        wasm_v128_load(g1), wasm_v128_load(g2),
+        wasm_v128_load(g3), wasm_v128_load(g3 + 4) };
+
+    v128_t m[5];
+    for (int j = 0; j < 5; j++)
+        m[j] = wasm_f32x4_splat(0);
+
+    for (int i = 0; i < 16; i++) {
+        v128_t xi = wasm_f32x4_splat(x[i]);
+        v128_t d;
+
+        for (int j = 0; j < 5; j++) {
+            d = wasm_f32x4_sub(xi, wasm_f32x4_mul(g[j],
+                wasm_f32x4_splat(cn[LC3_MIN(j, 3)][i])));
+            m[j] = wasm_f32x4_add(m[j], wasm_f32x4_mul(d, d));
+        }
+    }
+
+    wasm_v128_store(mse[0], m[0]);
+    wasm_v128_store(mse[1], m[1]);
+    wasm_v128_store(mse[2], m[2]);
+    wasm_v128_store(mse[3] + 0, m[3]);
+    wasm_v128_store(mse[3] + 4, m[4]);
+}
+
+#ifndef TEST_WASM
+#define compute_mse wasm_compute_mse
+#endif
+
+#endif /* compute_mse */
+
+#endif /* __wasm_simd128__ */
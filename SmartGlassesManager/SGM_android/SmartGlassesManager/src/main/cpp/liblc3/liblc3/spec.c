@@ -20,6 +20,9 @@
 #include "bits.h"
 #include "tables.h"
 
+#include "spec_neon.h"
+#include "spec_wasm.h"
+
 
 /* ----------------------------------------------------------------------------
  *  Global Gain / Quantization
@@ -36,6 +39,60 @@ static int resolve_gain_offset(enum lc3_srate sr, int nbytes)
     return 105 + 5*(1 + sr) + LC3_MIN(g_off, 115);
 }
 
+/**
+ * Energy (dB) by 4 MDCT blocks
+ * x               Spectral coefficients
+ * e, n            Output energies in fixed Q16 dB, and count of blocks
+ * return          The maximum of the squared coefficients
+ */
+#ifndef compute_energy_db
+LC3_HOT static inline float compute_energy_db(
+    const float *x, int *e, int n)
+{
+    float x2_max = 0;
+
+    for (int i = 0; i < n; i++, x += 4) {
+        float x0 = x[0] * x[0];
+        float x1 = x[1] * x[1];
+        float x2 = x[2] * x[2];
+        float x3 = x[3] * x[3];
+
+        x2_max = fmaxf(x2_max, x0);
+        x2_max = fmaxf(x2_max, x1);
+        x2_max = fmaxf(x2_max, x2);
+        x2_max = fmaxf(x2_max, x3);
+
+        e[i] = fast_db_q16(fmaxf(x0 + x1 + x2 + x3, 1e-10f));
+    }
+
+    return x2_max;
+}
+#endif /* compute_energy_db */
+
+/**
+ * Estimation of the bits consumption, for a gain value
+ * e, n            Energies of blocks in fixed Q16 dB, and count of blocks
+ * gn              The gain value in fixed Q16 dB
+ * return          Bits estimation, scaled by 1.4 in fixed Q16
+ */
+#ifndef estimate_nbits
+LC3_HOT static inline int estimate_nbits(const int *e, int n, int gn)
+{
+    const int k_2u7 = 2.7f * 0x1p16f + 0.5f;
+    int v = 0;
+
+    for (int j = 0; j < n; j++) {
+        int e_diff = e[j] - gn;
+
+        v += e_diff < 0 ? k_2u7 :
+             e_diff < 43 << 16 ?   e_diff + ( 7 << 16)
+                               : 2*e_diff - (36 << 16);
+    }
+
+    return v;
+}
+#endif /* estimate_nbits */
+
 /**
  * Global Gain Estimation
  * dt, sr          Duration and samplerate of the frame
@@ -55,21 +112,7 @@ LC3_HOT static int estimate_gain(
 
     /* --- Energy (dB) by 4 MDCT blocks --- */
 
-    float x2_max = 0;
-
-    for (int i = 0; i < ne; i++, x += 4) {
-        float x0 = x[0] * x[0];
-        float x1 = x[1] * x[1];
-        float x2 = x[2] * x[2];
-        float x3 = x[3] * x[3];
-
-        x2_max = fmaxf(x2_max, x0);
-        x2_max = fmaxf(x2_max, x1);
-        x2_max = fmaxf(x2_max, x2);
-        x2_max = fmaxf(x2_max, x3);
-
-        e[i] = fast_db_q16(fmaxf(x0 + x1 + x2 + x3, 1e-10f));
-    }
+    float x2_max = compute_energy_db(x, e, ne);
 
     /* --- Determine gain index --- */
 
@@ -77,22 +120,21 @@ LC3_HOT static int estimate_gain(
     int g_int = 255 - g_off;
 
     const int k_20_28 = 20.f/28 * 0x1p16f + 0.5f;
-    const int k_2u7 = 2.7f * 0x1p16f + 0.5f;
     const int k_1u4 = 1.4f * 0x1p16f + 0.5f;
 
-    for (int i = 128, j, j0 = ne-1, j1 ; i > 0; i >>= 1) {
-        int gn = (g_int - i) * k_20_28;
-        int v = 0;
+    /* The blocks above the highest one reaching the gain tested do not
+     * contribute. When the budget is exceeded, the gains tested afterwards
+     * are all greater, and the scan restarts from the last block found.
+     * Keeping the blocks settled by the range of gains left to test in
+     * partial sums does not pay: most blocks are close to the final gain,
+     * and remain to be scanned until the last steps. */
 
-        for (j = j0; j >= 0 && e[j] < gn; j--);
+    for (int i = 128, j0 = ne-1, j1 ; i > 0; i >>= 1) {
+        int gn = (g_int - i) * k_20_28;
 
-        for (j1 = j; j >= 0; j--) {
-            int e_diff = e[j] - gn;
+        for (j1 = j0; j1 >= 0 && e[j1] < gn; j1--);
 
-            v += e_diff < 0 ? k_2u7 :
-                 e_diff < 43 << 16 ?   e_diff + ( 7 << 16)
-                                   : 2*e_diff - (36 << 16);
-        }
+        int v = estimate_nbits(e, j1 + 1, gn);
 
         if (v > nbits * k_1u4)
             j0 = j1;
@@ -195,25 +237,21 @@ static float unquantize_gain(int g_int)
 }
 
 /**
- * Spectrum quantization
- * dt, sr          Duration and samplerate of the frame
- * g_int           Quantization gain value
- * x               Spectral coefficients, scaled as output
- * xq, nq          Output spectral quantized coefficients, and count
+ * Scale and quantize spectral coefficients
+ * g_inv           Inverse of the quantization gain
+ * x, n            Spectral coefficients, scaled as output, and count
+ * xq              Output spectral quantized coefficients
+ * return          Count of significant coefficients
  *
- * The spectral coefficients `xq` are stored as :
- *   b0       0:positive or zero  1:negative
- *   b15..b1  Absolute value
+ * The count `n` is assumed to be a multiple of 4 (every `LC3_NE()`).
  */
-LC3_HOT static void quantize(enum lc3_dt dt, enum lc3_srate sr,
-    int g_int, float *x, uint16_t *xq, int *nq)
+#ifndef scale_quantize
+LC3_HOT static inline int scale_quantize(
+    float g_inv, float *x, uint16_t *xq, int n)
 {
-    float g_inv = 1 / unquantize_gain(g_int);
-    int ne = LC3_NE(dt, sr);
+    int nq = n;
 
-    *nq = ne;
-
-    for (int i = 0; i < ne; i += 2) {
+    for (int i = 0; i < n; i += 2) {
         uint16_t x0, x1;
 
         x[i+0] *= g_inv;
@@ -225,8 +263,31 @@ LC3_HOT static void quantize(enum lc3_dt dt, enum lc3_srate sr,
         xq[i+0] = (x0 << 1) + ((x0 > 0) & (x[i+0] < 0));
         xq[i+1] = (x1 << 1) + ((x1 > 0) & (x[i+1] < 0));
 
-        *nq = x0 || x1 ? ne : *nq - 2;
+        nq = x0 || x1 ? n : nq - 2;
     }
+
+    return nq;
+}
+#endif /* scale_quantize */
+
+/**
+ * Spectrum quantization
+ * dt, sr          Duration and samplerate of the frame
+ * g_int           Quantization gain value
+ * x               Spectral coefficients, scaled as output
+ * xq, nq          Output spectral quantized coefficients, and count
+ *
+ * The spectral coefficients `xq` are stored as :
+ *   b0       0:positive or zero  1:negative
+ *   b15..b1  Absolute value
+ */
+LC3_HOT static void quantize(enum lc3_dt dt, enum lc3_srate sr,
+    int g_int, float *x, uint16_t *xq, int *nq)
+{
+    float g_inv = 1 / unquantize_gain(g_int);
+    int ne = LC3_NE(dt, sr);
+
+    *nq = scale_quantize(g_inv, x, xq, ne);
 }
 
 /**
@@ -407,15 +468,20 @@ LC3_HOT static void put_quantized(lc3_bits_t *bits,
             int m = (a | b) >> 2;
             int k = 0, shr = 0;
 
+            /* --- The plain bits, LSB planes followed by the signs,
+             *     are gathered and put at once (28 bits at most) --- */
+
+            unsigned pbits = 0;
+            int npbits = 0;
+
             if (m) {
 
                 if (lsb_mode)
                     lc3_put_symbol(bits,
                         lc3_spectrum_models + lut[k++], 16);
 
-                for (m >>= lsb_mode; m; m >>= 1, k++) {
-                    lc3_put_bit(bits, (a >> k) & 1);
-                    lc3_put_bit(bits, (b >> k) & 1);
+                for (m >>= lsb_mode; m; m >>= 1, k++, npbits += 2) {
+                    pbits |= (((a >> k) & 1) | ((b >> k) & 1) << 1) << npbits;
                     lc3_put_symbol(bits,
                         lc3_spectrum_models + lut[LC3_MIN(k, 3)], 16);
                 }
@@ -429,8 +495,11 @@ LC3_HOT static void put_quantized(lc3_bits_t *bits,
 
             /* --- Sign values --- */
 
-            if (a) lc3_put_bit(bits, x[i+0] & 1);
-            if (b) lc3_put_bit(bits, x[i+1] & 1);
+            if (a) pbits |= (x[i+0] & 1) << (npbits++);
+            if (b) pbits |= (x[i+1] & 1) << (npbits++);
+
+            if (npbits)
+                lc3_put_bits(bits, pbits, npbits);
 
             /* --- MSB values --- */
 
@@ -491,8 +560,9 @@ LC3_HOT static int get_quantized(lc3_bits_t *bits,
             }
 
             for ( ; s >= 16 && shl < 14; shl++) {
-                u |= lc3_get_bit(bits) << shl;
-                v |= lc3_get_bit(bits) << shl;
+                unsigned uv = lc3_get_bits(bits, 2);
+                u |= (uv & 1) << shl;
+                v |= (uv >> 1) << shl;
 
                 k += (k < 3);
                 s  = lc3_get_symbol(bits, lc3_spectrum_models + lut[k]);
@@ -664,13 +734,13 @@ LC3_HOT static void get_lsb(lc3_bits_t *bits,
 LC3_HOT static int estimate_noise(enum lc3_dt dt, enum lc3_bandwidth bw,
     const uint16_t *xq, int nq, const float *x)
 {
-    int bw_stop = (dt == LC3_DT_7M5 ? 60 : 80) * (1 + bw);
-    int w = 2 + dt;
+    int bw_stop = LC3_NE(dt, bw);
+    int w = 1 + (dt >= LC3_DT_7M5) + (dt >= LC3_DT_10M);
 
     float sum = 0;
     int i, n = 0, z = 0;
 
-    for (i = 6*(3 + dt) - w; i < LC3_MIN(nq, bw_stop); i++) {
+    for (i = 6*(1 + dt) - w; i < LC3_MIN(nq, bw_stop); i++) {
         z = xq[i] ? 0 : z + 1;
         if (z > 2*w)
             sum += fabsf(x[i - w]), n++;
@@ -695,13 +765,13 @@ LC3_HOT static int estimate_noise(enum lc3_dt dt, enum lc3_bandwidth bw,
 LC3_HOT static void fill_noise(enum lc3_dt dt, enum lc3_bandwidth bw,
     int nf, uint16_t nf_seed, float g, float *x, int nq)
 {
-    int bw_stop = (dt == LC3_DT_7M5 ? 60 : 80) * (1 + bw);
-    int w = 2 + dt;
+    int bw_stop = LC3_NE(dt, bw);
+    int w = 1 + (dt >= LC3_DT_7M5) + (dt >= LC3_DT_10M);
 
     float s = g * (float)(8 - nf) / 16;
     int i, z = 0;
 
-    for (i = 6*(3 + dt) - w; i < LC3_MIN(nq, bw_stop); i++) {
+    for (i = 6*(1 + dt) - w; i < LC3_MIN(nq, bw_stop); i++) {
         z = x[i] ? 0 : z + 1;
         if (z > 2*w) {
             nf_seed = (13849 + nf_seed*31821) & 0xffff;
@@ -766,10 +836,13 @@ static int get_nbits_ac(enum lc3_dt dt, enum lc3_srate sr, int nbytes)
  * Spectrum analysis
  */
 void lc3_spec_analyze(enum lc3_dt dt, enum lc3_srate sr,
-    int nbytes, bool pitch, const lc3_tns_data_t *tns,
+    int nbytes, bool pitch, const lc3_tns_data_t *tns, bool fine_gain,
     struct lc3_spec_analysis *spec, float *x,
     uint16_t *xq, struct lc3_spec_side *side)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     bool reset_off;
 
     /* --- Bit budget --- */
@@ -805,6 +878,9 @@ void lc3_spec_analyze(enum lc3_dt dt, enum lc3_srate sr,
 
     int g_adj = adjust_gain(sr, g_int + g_off, nbits, nbits_budget);
 
+    if (!fine_gain)
+        g_adj = LC3_MAX(g_adj, 0);
+
     if (g_adj)
         quantize(dt, sr, g_adj, x, xq, &side->nq);
 
@@ -819,6 +895,9 @@ void lc3_spec_analyze(enum lc3_dt dt, enum lc3_srate sr,
 void lc3_spec_put_side(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_srate sr, const struct lc3_spec_side *side)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     int nbits_nq = get_nbits_nq(dt, sr);
 
     lc3_put_bits(bits, LC3_MAX(side->nq >> 1, 1) - 1, nbits_nq);
@@ -833,6 +912,9 @@ void lc3_spec_encode(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw, int nbytes,
     const uint16_t *xq, const lc3_spec_side_t *side, const float *x)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     bool lsb_mode = side->lsb_mode;
     int nq = side->nq;
 
@@ -859,6 +941,9 @@ void lc3_spec_encode(lc3_bits_t *bits,
 int lc3_spec_get_side(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_srate sr, struct lc3_spec_side *side)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     int nbits_nq = get_nbits_nq(dt, sr);
     int ne = LC3_NE(dt, sr);
 
@@ -876,6 +961,9 @@ int lc3_spec_decode(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw,
     int nbytes, const lc3_spec_side_t *side, float *x)
 {
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
     bool lsb_mode = side->lsb_mode;
     int nq = side->nq;
     int ret = 0;
@@ -902,3 +990,41 @@ int lc3_spec_decode(lc3_bits_t *bits,
 
     return 0;
 }
+
+/**
+ * Estimate spectral coefficients
+ */
+void lc3_spec_estimate(lc3_bits_t *bits,
+    enum lc3_dt dt, enum lc3_srate sr, enum lc3_bandwidth bw,
+    int nbytes, const lc3_spec_side_t *side, float *x)
+{
+    LC3_BIND_DT(dt);
+    LC3_BIND_SR(sr);
+
+    int ne = LC3_NE(dt, sr);
+    int nq = side->nq;
+    int bw_stop = LC3_NE(dt, bw);
+
+    int nf = get_noise_factor(bits);
+    int nbits = lc3_get_bits_left(bits);
+
+    /* --- The significant coefficients follow the high rate approximation
+     *     of the quantizer, with the bits left shared equally. Above,
+     *     the coefficients are filled with noise --- */
+
+    int g_int = side->g_idx - resolve_gain_offset(sr, nbytes);
+    float g = unquantize_gain(g_int);
+
+    float a = g * fast_exp2f(LC3_MIN((float)nbits / nq, 15)) * 0.28867513f;
+    float s = g * (float)(8 - nf) / 16;
+    int i;
+
+    for (i = 0; i < nq; i++)
+        x[i] = a;
+
+    for ( ; i < LC3_MIN(bw_stop, ne); i++)
+        x[i] = s;
+
+    for ( ; i < ne; i++)
+        x[i] = 0;
+}
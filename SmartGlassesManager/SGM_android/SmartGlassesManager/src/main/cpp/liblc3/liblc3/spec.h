@@ -51,6 +51,9 @@ typedef struct lc3_spec_side {
  * Spectrum analysis
  * dt, sr, nbytes  Duration, samplerate and size of the frame
  * pitch, tns      Pitch present indication and TNS bistream data
+ * fine_gain       Lower the gain when bits remain, at the cost of a
+ *                 second quantization. Otherwise the gain is only raised
+ *                 when the frame overflows.
  * spec            Context of analysis
  * x               Spectral coefficients, scaled as output
  * xq, side        Return quantization data
@@ -60,7 +63,7 @@ typedef struct lc3_spec_side {
  *   b15..b1  Absolute value
  */
 void lc3_spec_analyze(enum lc3_dt dt, enum lc3_srate sr,
-    int nbytes, bool pitch, const lc3_tns_data_t *tns,
+    int nbytes, bool pitch, const lc3_tns_data_t *tns, bool fine_gain,
     lc3_spec_analysis_t *spec, float *x, uint16_t *xq, lc3_spec_side_t *side);
 
 /**
@@ -115,5 +118,19 @@ int lc3_spec_get_side(lc3_bits_t *bits,
 int lc3_spec_decode(lc3_bits_t *bits, enum lc3_dt dt, enum lc3_srate sr,
     enum lc3_bandwidth bw, int nbytes, const lc3_spec_side_t *side, float *x);
 
+/**
+ * Estimate spectral coefficients, without decoding them
+ * bits            Bitstream context
+ * dt, sr, bw      Duration, samplerate, bandwidth
+ * nbytes          and size of the frame
+ * side            Quantization side data
+ * x               Return the expected magnitude of coefficients
+ *
+ * Only the noise factor is read, the magnitudes are derived from the
+ * global gain and the bits left for the coding of the coefficients.
+ */
+void lc3_spec_estimate(lc3_bits_t *bits, enum lc3_dt dt, enum lc3_srate sr,
+    enum lc3_bandwidth bw, int nbytes, const lc3_spec_side_t *side, float *x);
+
 
 #endif /* __LC3_SPEC_H */
@@ -0,0 +1,211 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+#ifndef compute_energy_db
+
+/**
+ * Fast `10 * log10(x)` approximation in fixed Q16, see `fast_db_q16()`
+ */
+LC3_HOT static inline int32x4_t neon_fast_db_q16(float32x4_t x)
+{
+    /* --- Columns of the table of `fast_db_q16()`, looked up by bytes --- */
+
+    static const alignas(16) uint16_t t[2][32] = {
+
+        {     0,  4379,  8627, 12753, 16762, 20661, 24456, 28153,
+          31755, 35269, 38699, 42047, 45319, 48517, 51645, 54705,
+           8381, 11315, 14190, 17008, 19772, 22482, 25142, 27754,
+          30318, 32837, 35312, 37744, 40136, 42489, 44803, 47080 },
+
+        {  4379,  4248,  4125,  4009,  3899,  3795,  3697,  3603,
+           3514,  3429,  3349,  3272,  3198,  3128,  3061,  2996,
+           2934,  2875,  2818,  2763,  2711,  2660,  2611,  2564,
+           2519,  2475,  2433,  2392,  2352,  2314,  2277,  2241 },
+
+    };
+
+    const uint8_t *t0 = (const uint8_t *)t[0];
+    const uint8_t *t1 = (const uint8_t *)t[1];
+
+    uint8x16x4_t t0q = { { vld1q_u8(t0 +  0), vld1q_u8(t0 + 16),
+                           vld1q_u8(t0 + 32), vld1q_u8(t0 + 48) } };
+    uint8x16x4_t t1q = { { vld1q_u8(t1 +  0), vld1q_u8(t1 + 16),
+                           vld1q_u8(t1 + 32), vld1q_u8(t1 + 48) } };
+
+    /* --- Split the square, and lookup the table ---
+     * The indexes of the bytes of the 16 bits entries are `2 hi`, and
+     * `2 hi + 1`, the out of range index 0xff clears the upper bytes */
+
+    uint32x4_t x2 = vreinterpretq_u32_f32(vmulq_f32(x, x));
+
+    int32x4_t e2 = vsubq_s32(
+        vreinterpretq_s32_u32(vshrq_n_u32(x2, 22)), vdupq_n_s32(2*127));
+    uint32x4_t hi = vandq_u32(vshrq_n_u32(x2, 18), vdupq_n_u32(0x1f));
+    uint32x4_t lo = vandq_u32(vshrq_n_u32(x2,  2), vdupq_n_u32(0xffff));
+
+    uint8x16_t idx = vreinterpretq_u8_u32(
+        vmlaq_n_u32(vdupq_n_u32(0xffff0100), hi, 0x0202));
+
+    int32x4_t y0 = vreinterpretq_s32_u8(vqtbl4q_u8(t0q, idx));
+    uint32x4_t y1 = vreinterpretq_u32_u8(vqtbl4q_u8(t1q, idx));
+
+    int32x4_t y = vmlaq_n_s32(y0, e2, 49321);
+    return vaddq_s32(y, vreinterpretq_s32_u32(
+        vshrq_n_u32(vmulq_u32(y1, lo), 16)));
+}
+
+/**
+ * Energy (dB) by 4 MDCT blocks
+ */
+LC3_HOT static inline float neon_compute_energy_db(
+    const float *x, int *e, int n)
+{
+    float32x4_t x2_max = vdupq_n_f32(0);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4, x += 16) {
+        float32x4x4_t xv = vld4q_f32(x);
+
+        float32x4_t x0 = vmulq_f32(xv.val[0], xv.val[0]);
+        float32x4_t x1 = vmulq_f32(xv.val[1], xv.val[1]);
+        float32x4_t x2 = vmulq_f32(xv.val[2], xv.val[2]);
+        float32x4_t x3 = vmulq_f32(xv.val[3], xv.val[3]);
+
+        x2_max = vmaxq_f32(x2_max,
+            vmaxq_f32(vmaxq_f32(x0, x1), vmaxq_f32(x2, x3)));
+
+        float32x4_t s = vaddq_f32(vaddq_f32(vaddq_f32(x0, x1), x2), x3);
+        vst1q_s32(e + i, neon_fast_db_q16(vmaxq_f32(s, vdupq_n_f32(1e-10f))));
+    }
+
+    float x2_max_s = vmaxvq_f32(x2_max);
+
+    for ( ; i < n; i++, x += 4) {
+        float x0 = x[0] * x[0];
+        float x1 = x[1] * x[1];
+        float x2 = x[2] * x[2];
+        float x3 = x[3] * x[3];
+
+        x2_max_s = fmaxf(x2_max_s, fmaxf(fmaxf(x0, x1), fmaxf(x2, x3)));
+        e[i] = fast_db_q16(fmaxf(x0 + x1 + x2 + x3, 1e-10f));
+    }
+
+    return x2_max_s;
+}
+
+#ifndef TEST_NEON
+#define compute_energy_db neon_compute_energy_db
+#endif
+
+#endif /* compute_energy_db */
+
+/**
+ * Estimation of the bits consumption, for a gain value
+ */
+#ifndef estimate_nbits
+
+LC3_HOT static inline int neon_estimate_nbits(const int *e, int n, int gn)
+{
+    const int k_2u7 = 2.7f * 0x1p16f + 0.5f;
+
+    /* --- The terms over 0 dB are the maximum of the 2 lines,
+     *     crossing at 43 dB --- */
+
+    int32x4_t gnq = vdupq_n_s32(gn);
+    int32x4_t k_2u7q = vdupq_n_s32(k_2u7);
+    int32x4_t k_7q = vdupq_n_s32(7 << 16);
+    int32x4_t k_36q = vdupq_n_s32(36 << 16);
+
+    int32x4_t vq = vdupq_n_s32(0);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        int32x4_t e_diff = vsubq_s32(vld1q_s32(e + i), gnq);
+
+        int32x4_t u = vmaxq_s32(vaddq_s32(e_diff, k_7q),
+            vsubq_s32(vaddq_s32(e_diff, e_diff), k_36q));
+
+        vq = vaddq_s32(vq, vbslq_s32(vcltzq_s32(e_diff), k_2u7q, u));
+    }
+
+    int v = vaddvq_s32(vq);
+
+    for ( ; i < n; i++) {
+        int e_diff = e[i] - gn;
+
+        v += e_diff < 0 ? k_2u7 :
+             e_diff < 43 << 16 ?   e_diff + ( 7 << 16)
+                               : 2*e_diff - (36 << 16);
+    }
+
+    return v;
+}
+
+#ifndef TEST_NEON
+#define estimate_nbits neon_estimate_nbits
+#endif
+
+#endif /* estimate_nbits */
+
+/**
+ * Scale and quantize spectral coefficients
+ */
+#ifndef scale_quantize
+
+LC3_HOT static inline int neon_scale_quantize(
+    float g_inv, float *x, uint16_t *xq, int n)
+{
+    float32x4_t k_6u16 = vdupq_n_f32(6.f/16);
+    float32x4_t k_max = vdupq_n_f32(INT16_MAX);
+    int nq = 0;
+
+    for (int i = 0; i < n; i += 4) {
+        float32x4_t xv = vmulq_n_f32(vld1q_f32(x + i), g_inv);
+        vst1q_f32(x + i, xv);
+
+        uint32x4_t a = vcvtq_u32_f32(
+            vminnmq_f32(vaddq_f32(vabsq_f32(xv), k_6u16), k_max));
+
+        uint32x4_t s = vandq_u32(vcltzq_f32(xv), vtstq_u32(a, a));
+        vst1_u16(xq + i, vmovn_u32(vsubq_u32(vshlq_n_u32(a, 1), s)));
+
+        /* --- Pairs of coefficients, in the 2 halves of 64 bits --- */
+
+        uint64_t a64 = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(a)), 0);
+        nq = a64 >> 32 ? i + 4 : (uint32_t)a64 ? i + 2 : nq;
+    }
+
+    return nq;
+}
+
+#ifndef TEST_NEON
+#define scale_quantize neon_scale_quantize
+#endif
+
+#endif /* scale_quantize */
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
@@ -0,0 +1,243 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __wasm_simd128__ || defined(TEST_WASM)
+
+#ifndef TEST_WASM
+#include <wasm_simd128.h>
+#endif /* TEST_WASM */
+
+
+#ifndef compute_energy_db
+
+/**
+ * Fast `10 * log10(x)` approximation in fixed Q16, see `fast_db_q16()`
+ */
+LC3_HOT static inline v128_t wasm_fast_db_q16(v128_t x)
+{
+    /* --- Columns of the table of `fast_db_q16()`, looked up by bytes --- */
+
+    static const alignas(16) uint16_t t[2][32] = {
+
+        {     0,  4379,  8627, 12753, 16762, 20661, 24456, 28153,
+          31755, 35269, 38699, 42047, 45319, 48517, 51645, 54705,
+           8381, 11315, 14190, 17008, 19772, 22482, 25142, 27754,
+          30318, 32837, 35312, 37744, 40136, 42489, 44803, 47080 },
+
+        {  4379,  4248,  4125,  4009,  3899,  3795,  3697,  3603,
+           3514,  3429,  3349,  3272,  3198,  3128,  3061,  2996,
+           2934,  2875,  2818,  2763,  2711,  2660,  2611,  2564,
+           2519,  2475,  2433,  2392,  2352,  2314,  2277,  2241 },
+
+    };
+
+    /* --- Split the square ---
+     * The indexes of the bytes of the 16 bits entries are `2 hi`, and
+     * `2 hi + 1`, the out of range index 0xff clears the upper bytes */
+
+    v128_t x2 = wasm_f32x4_mul(x, x);
+
+    v128_t e2 = wasm_i32x4_sub(
+        wasm_u32x4_shr(x2, 22), wasm_i32x4_splat(2*127));
+    v128_t hi = wasm_v128_and(wasm_u32x4_shr(x2, 18), wasm_i32x4_splat(0x1f));
+    v128_t lo = wasm_v128_and(wasm_u32x4_shr(x2,  2), wasm_i32x4_splat(0xffff));
+
+    v128_t idx = wasm_i32x4_add(wasm_u32x4_splat(0xffff0100),
+        wasm_i32x4_mul(hi, wasm_i32x4_splat(0x0202)));
+
+    /* --- Lookup by quarters of 16 bytes, the swizzle clears
+     *     the out of range indexes --- */
+
+    v128_t y0 = wasm_i32x4_splat(0), y1 = wasm_i32x4_splat(0);
+
+    for (int i = 0; i < 4; i++) {
+        v128_t idx_i = wasm_i8x16_sub(idx, wasm_i8x16_splat(16 * i));
+
+        y0 = wasm_v128_or(y0, wasm_i8x16_swizzle(
+            wasm_v128_load((const uint8_t *)t[0] + 16 * i), idx_i));
+        y1 = wasm_v128_or(y1, wasm_i8x16_swizzle(
+            wasm_v128_load((const uint8_t *)t[1] + 16 * i), idx_i));
+    }
+
+    v128_t y = wasm_i32x4_add(y0,
+        wasm_i32x4_mul(e2, wasm_i32x4_splat(49321)));
+    return wasm_i32x4_add(y, wasm_u32x4_shr(wasm_i32x4_mul(y1, lo), 16));
+}
+
+/**
+ * Energy (dB) by 4 MDCT blocks
+ */
+LC3_HOT static inline float wasm_compute_energy_db(
+    const float *x, int *e, int n)
+{
+    v128_t x2_max = wasm_f32x4_splat(0);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4, x += 16) {
+
+        /* --- Transpose the 4 blocks --- */
+
+        v128_t a0 = wasm_v128_load(x +  0), a1 = wasm_v128_load(x +  4);
+        v128_t a2 = wasm_v128_load(x +  8), a3 = wasm_v128_load(x + 12);
+
+        v128_t b0 = wasm_i32x4_shuffle(a0, a1, 0, 4, 1, 5);
+        v128_t b1 = wasm_i32x4_shuffle(a2, a3, 0, 4, 1, 5);
+        v128_t b2 = wasm_i32x4_shuffle(a0, a1, 2, 6, 3, 7);
+        v128_t b3 = wasm_i32x4_shuffle(a2, a3, 2, 6, 3, 7);
+
+        a0 = wasm_i64x2_shuffle(b0, b1, 0, 2);
+        a1 = wasm_i64x2_shuffle(b0, b1, 1, 3);
+        a2 = wasm_i64x2_shuffle(b2, b3, 0, 2);
+        a3 = wasm_i64x2_shuffle(b2, b3, 1, 3);
+
+        /* --- Energy and maximum --- */
+
+        v128_t x0 = wasm_f32x4_mul(a0, a0);
+        v128_t x1 = wasm_f32x4_mul(a1, a1);
+        v128_t x2 = wasm_f32x4_mul(a2, a2);
+        v128_t x3 = wasm_f32x4_mul(a3, a3);
+
+        x2_max = wasm_f32x4_max(x2_max,
+            wasm_f32x4_max(wasm_f32x4_max(x0, x1), wasm_f32x4_max(x2, x3)));
+
+        v128_t s = wasm_f32x4_add(
+            wasm_f32x4_add(wasm_f32x4_add(x0, x1), x2), x3);
+        wasm_v128_store(e + i,
+            wasm_fast_db_q16(wasm_f32x4_max(s, wasm_f32x4_splat(1e-10f))));
+    }
+
+    float x2_max_s = fmaxf(
+        fmaxf(wasm_f32x4_extract_lane(x2_max, 0),
+              wasm_f32x4_extract_lane(x2_max, 1)),
+        fmaxf(wasm_f32x4_extract_lane(x2_max, 2),
+              wasm_f32x4_extract_lane(x2_max, 3)) );
+
+    for ( ; i < n; i++, x += 4) {
+        float x0 = x[0] * x[0];
+        float x1 = x[1] * x[1];
+        float x2 = x[2] * x[2];
+        float x3 = x[3] * x[3];
+
+        x2_max_s = fmaxf(x2_max_s, fmaxf(fmaxf(x0, x1), fmaxf(x2, x3)));
+        e[i] = fast_db_q16(fmaxf(x0 + x1 + x2 + x3, 1e-10f));
+    }
+
+    return x2_max_s;
+}
+
+#ifndef TEST_WASM
+#define compute_energy_db wasm_compute_energy_db
+#endif
+
+#endif /* compute_energy_db */
+
+/**
+ * Estimation of the bits consumption, for a gain value
+ */
+#ifndef estimate_nbits
+
+LC3_HOT static inline int wasm_estimate_nbits(const int *e, int n, int gn)
+{
+    const int k_2u7 = 2.7f * 0x1p16f + 0.5f;
+
+    /* --- The terms over 0 dB are the maximum of the 2 lines,
+     *     crossing at 43 dB --- */
+
+    v128_t gnq = wasm_i32x4_splat(gn);
+    v128_t k_2u7q = wasm_i32x4_splat(k_2u7);
+    v128_t k_7q = wasm_i32x4_splat(7 << 16);
+    v128_t k_36q = wasm_i32x4_splat(36 << 16);
+
+    v128_t vq = wasm_i32x4_splat(0);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        v128_t e_diff = wasm_i32x4_sub(wasm_v128_load(e + i), gnq);
+
+        v128_t u = wasm_i32x4_max(wasm_i32x4_add(e_diff, k_7q),
+            wasm_i32x4_sub(wasm_i32x4_add(e_diff, e_diff), k_36q));
+
+        vq = wasm_i32x4_add(vq, wasm_v128_bitselect(k_2u7q, u,
+            wasm_i32x4_lt(e_diff, wasm_i32x4_splat(0))));
+    }
+
+    vq = wasm_i32x4_add(vq, wasm_i32x4_shuffle(vq, vq, 2, 3, 0, 1));
+    vq = wasm_i32x4_add(vq, wasm_i32x4_shuffle(vq, vq, 1, 0, 3, 2));
+    int v = wasm_i32x4_extract_lane(vq, 0);
+
+    for ( ; i < n; i++) {
+        int e_diff = e[i] - gn;
+
+        v += e_diff < 0 ? k_2u7 :
+             e_diff < 43 << 16 ?   e_diff + ( 7 << 16)
+                               : 2*e_diff - (36 << 16);
+    }
+
+    return v;
+}
+
+#ifndef TEST_WASM
+#define estimate_nbits wasm_estimate_nbits
+#endif
+
+#endif /* estimate_nbits */
+
+/**
+ * Scale and quantize spectral coefficients
+ */
+#ifndef scale_quantize
+
+LC3_HOT static inline int wasm_scale_quantize(
+    float g_inv, float *x, uint16_t *xq, int n)
+{
+    v128_t g_invq = wasm_f32x4_splat(g_inv);
+    v128_t k_6u16 = wasm_f32x4_splat(6.f/16);
+    v128_t k_max = wasm_f32x4_splat(INT16_MAX);
+    v128_t zero = wasm_i32x4_splat(0);
+    int nq = 0;
+
+    for (int i = 0; i < n; i += 4) {
+        v128_t xv = wasm_f32x4_mul(wasm_v128_load(x + i), g_invq);
+        wasm_v128_store(x + i, xv);
+
+        v128_t a = wasm_i32x4_trunc_sat_f32x4(
+            wasm_f32x4_min(wasm_f32x4_add(wasm_f32x4_abs(xv), k_6u16), k_max));
+
+        v128_t s = wasm_v128_and(
+            wasm_f32x4_lt(xv, zero), wasm_i32x4_ne(a, zero));
+        v128_t y = wasm_i32x4_sub(wasm_i32x4_shl(a, 1), s);
+        wasm_v128_store64_lane(xq + i, wasm_u16x8_narrow_i32x4(y, y), 0);
+
+        /* --- Pairs of coefficients, in the 2 halves of 64 bits --- */
+
+        uint64_t a64 = wasm_i64x2_extract_lane(
+            wasm_u16x8_narrow_i32x4(a, a), 0);
+        nq = a64 >> 32 ? i + 4 : (uint32_t)a64 ? i + 2 : nq;
+    }
+
+    return nq;
+}
+
+#ifndef TEST_WASM
+#define scale_quantize wasm_scale_quantize
+#endif
+
+#endif /* scale_quantize */
+
+#endif /* __wasm_simd128__ */
@@ -438,6 +438,31 @@ const struct lc3_fft_bf2_twiddles *lc3_fft_twiddles_bf2[][3] = {
  *   W[n] = e                   , n = [0..N/4-1]
  */
 
+static const struct lc3_mdct_rot_def mdct_rot_40 = {
+    .n4 = 40/4, .w = (const struct lc3_complex []){
+        { 9.9980724e-01, 1.9633692e-02 }, { 9.8442657e-01, 1.7579628e-01 },
+        { 9.4480605e-01, 3.2763018e-01 }, { 8.8192126e-01, 4.7139674e-01 },
+        { 7.9732065e-01, 6.0355594e-01 }, { 6.9308736e-01, 7.2085360e-01 },
+        { 5.7178796e-01, 8.2040144e-01 }, { 4.3640924e-01, 8.9974828e-01 },
+        { 2.9028468e-01, 9.5694034e-01 }, { 1.3701234e-01, 9.9056934e-01 },
+    }
+};
+
+static const struct lc3_mdct_rot_def mdct_rot_80 = {
+    .n4 = 80/4, .w = (const struct lc3_complex []){
+        { 9.9995181e-01, 9.8173193e-03 }, { 9.9609903e-01, 8.8242371e-02 },
+        { 9.8610498e-01, 1.6612338e-01 }, { 9.7003125e-01, 2.4298018e-01 },
+        { 9.4797697e-01, 3.1833893e-01 }, { 9.2007808e-01, 3.9173501e-01 },
+        { 8.8650662e-01, 4.6271592e-01 }, { 8.4746954e-01, 5.3084403e-01 },
+        { 8.0320753e-01, 5.9569930e-01 }, { 7.5399348e-01, 6.5688190e-01 },
+        { 7.0013081e-01, 7.1401460e-01 }, { 6.4195160e-01, 7.6674516e-01 },
+        { 5.7981455e-01, 8.1474848e-01 }, { 5.1410274e-01, 8.5772861e-01 },
+        { 4.4522133e-01, 8.9542056e-01 }, { 3.7359497e-01, 9.2759194e-01 },
+        { 2.9966528e-01, 9.5404440e-01 }, { 2.2388805e-01, 9.7461487e-01 },
+        { 1.4673047e-01, 9.8917651e-01 }, { 6.8668259e-02, 9.9763955e-01 },
+    }
+};
+
 static const struct lc3_mdct_rot_def mdct_rot_120 = {
     .n4 = 120/4, .w = (const struct lc3_complex []){
         { 9.9997858e-01, 6.5449380e-03 }, { 9.9826561e-01, 5.8870804e-02 },
@@ -984,10 +1009,38 @@ static const struct lc3_mdct_rot_def mdct_rot_960 = {
 };
 
 const struct lc3_mdct_rot_def * lc3_mdct_rot[LC3_NUM_DT][LC3_NUM_SRATE] = {
-    [LC3_DT_7M5] = { &mdct_rot_120, &mdct_rot_240, &mdct_rot_360,
-                     &mdct_rot_480, &mdct_rot_720                },
-    [LC3_DT_10M] = { &mdct_rot_160, &mdct_rot_320, &mdct_rot_480,
-                     &mdct_rot_640, &mdct_rot_960                }
+
+    [LC3_DT_2M5] = {
+        [LC3_SRATE_8K ] = LC3_WITH( 2500,  8000, &mdct_rot_40),
+        [LC3_SRATE_16K] = LC3_WITH( 2500, 16000, &mdct_rot_80),
+        [LC3_SRATE_24K] = LC3_WITH( 2500, 24000, &mdct_rot_120),
+        [LC3_SRATE_32K] = LC3_WITH( 2500, 32000, &mdct_rot_160),
+        [LC3_SRATE_48K] = LC3_WITH( 2500, 48000, &mdct_rot_240),
+    },
+
+    [LC3_DT_5M] = {
+        [LC3_SRATE_8K ] = LC3_WITH( 5000,  8000, &mdct_rot_80),
+        [LC3_SRATE_16K] = LC3_WITH( 5000, 16000, &mdct_rot_160),
+        [LC3_SRATE_24K] = LC3_WITH( 5000, 24000, &mdct_rot_240),
+        [LC3_SRATE_32K] = LC3_WITH( 5000, 32000, &mdct_rot_320),
+        [LC3_SRATE_48K] = LC3_WITH( 5000, 48000, &mdct_rot_480),
+    },
+
+    [LC3_DT_7M5] = {
+        [LC3_SRATE_8K ] = LC3_WITH( 7500,  8000, &mdct_rot_120),
+        [LC3_SRATE_16K] = LC3_WITH( 7500, 16000, &mdct_rot_240),
+        [LC3_SRATE_24K] = LC3_WITH( 7500, 24000, &mdct_rot_360),
+        [LC3_SRATE_32K] = LC3_WITH( 7500, 32000, &mdct_rot_480),
+        [LC3_SRATE_48K] = LC3_WITH( 7500, 48000, &mdct_rot_720),
+    },
+
+    [LC3_DT_10M] = {
+        [LC3_SRATE_8K ] = LC3_WITH(10000,  8000, &mdct_rot_160),
+        [LC3_SRATE_16K] = LC3_WITH(10000, 16000, &mdct_rot_320),
+        [LC3_SRATE_24K] = LC3_WITH(10000, 24000, &mdct_rot_480),
+        [LC3_SRATE_32K] = LC3_WITH(10000, 32000, &mdct_rot_640),
+        [LC3_SRATE_48K] = LC3_WITH(10000, 48000, &mdct_rot_960),
+    },
 };
 
 
@@ -1971,32 +2024,573 @@ static const float mdct_win_7m5_360[360+276] = {
      5.82657334e-03,  4.87838525e-03,  4.02351119e-03,  3.15418663e-03,
 };
 
+/**
+ * Low delay MDCT windows of 2.5ms and 5ms frames
+ *
+ * The 10ms window is stretched over 8/5 of the frame, giving a delay
+ * of 1/5 of the frame (0.5ms and 1ms) over the frame duration, and is
+ * normalized to satisfy :
+ *   W[n] W[2N-1-n] + W[N+n] W[N-1-n] = 1 , n = [0..N-1]
+ * so that the time reversed synthesis window reconstructs perfectly.
+ */
+
+static const float mdct_win_2m5_20[20+12] = {
+    -3.23782904e-03, -2.45757848e-02, -6.49959611e-02, -1.01781554e-01,
+    -1.07709764e-01, -6.43866795e-02,  4.65559387e-02,  2.46886006e-01,
+     5.47594771e-01,  9.05528000e-01,  1.11309595e+00,  1.08687113e+00,
+     1.02035578e+00,  9.95678819e-01,  9.88374796e-01,  9.87854744e-01,
+     9.89338246e-01,  9.90111803e-01,  9.91592679e-01,  9.96491455e-01,
+     1.00352090e+00,  1.00847860e+00,  1.00998695e+00,  1.01077665e+00,
+     1.01229458e+00,  1.01176194e+00,  1.00433993e+00,  9.80050312e-01,
+     8.98562363e-01,  6.63964248e-01,  2.88167883e-01,  4.26930905e-02,
+};
+
+static const float mdct_win_2m5_40[40+24] = {
+    -1.31326568e-03, -6.37368362e-03, -1.70074728e-02, -3.34750014e-02,
+    -5.40825765e-02, -7.56980661e-02, -9.45482407e-02, -1.07019366e-01,
+    -1.10246536e-01, -1.02102428e-01, -8.07152552e-02, -4.38730116e-02,
+     1.12111534e-02,  8.75748929e-02,  1.87597194e-01,  3.12600113e-01,
+     4.63242721e-01,  6.36686222e-01,  8.19488023e-01,  9.81611326e-01,
+     1.08728616e+00,  1.12226958e+00,  1.10498311e+00,  1.06732370e+00,
+     1.03304357e+00,  1.01099759e+00,  9.99368834e-01,  9.92877557e-01,
+     9.89342905e-01,  9.87817723e-01,  9.87630522e-01,  9.88197194e-01,
+     9.88987941e-01,  9.89619351e-01,  9.89978518e-01,  9.90280421e-01,
+     9.90966090e-01,  9.92457880e-01,  9.94929827e-01,  9.98204826e-01,
+     1.00179840e+00,  1.00509601e+00,  1.00759944e+00,  1.00911627e+00,
+     1.00981498e+00,  1.01012293e+00,  1.01048954e+00,  1.01113468e+00,
+     1.01194378e+00,  1.01252440e+00,  1.01233252e+00,  1.01077189e+00,
+     1.00717354e+00,  1.00063156e+00,  9.89122037e-01,  9.68013384e-01,
+     9.28974878e-01,  8.58328611e-01,  7.41632952e-01,  5.75236932e-01,
+     3.81569403e-01,  2.04625193e-01,  8.09839779e-02,  1.83124135e-02,
+};
+
+static const float mdct_win_2m5_60[60+36] = {
+    -8.93160050e-04, -3.23782904e-03, -7.72746266e-03, -1.48115444e-02,
+    -2.45757848e-02, -3.66930787e-02, -5.04806910e-02, -6.49959611e-02,
+    -7.91363088e-02, -9.17588819e-02, -1.01781554e-01, -1.08265350e-01,
+    -1.10446823e-01, -1.07709764e-01, -9.95107719e-02, -8.52859675e-02,
+    -6.43866795e-02, -3.60414825e-02,  6.32860991e-04,  4.65559387e-02,
+     1.02556012e-01,  1.69220084e-01,  2.46886006e-01,  3.36002186e-01,
+     4.36396156e-01,  5.47594771e-01,  6.67105156e-01,  7.89452601e-01,
+     9.05528000e-01,  1.00394218e+00,  1.07463772e+00,  1.11309595e+00,
+     1.12217578e+00,  1.11012157e+00,  1.08687113e+00,  1.06095557e+00,
+     1.03812766e+00,  1.02035578e+00,  1.00849477e+00,  1.00082678e+00,
+     9.95678819e-01,  9.92113606e-01,  9.89771461e-01,  9.88374796e-01,
+     9.87709838e-01,  9.87594041e-01,  9.87854744e-01,  9.88326407e-01,
+     9.88859682e-01,  9.89338246e-01,  9.89696302e-01,  9.89932190e-01,
+     9.90111803e-01,  9.90354988e-01,  9.90805223e-01,  9.91592679e-01,
+     9.92802137e-01,  9.94452871e-01,  9.96491455e-01,  9.98797835e-01,
+     1.00120361e+00,  1.00352090e+00,  1.00557807e+00,  1.00725005e+00,
+     1.00847860e+00,  1.00928011e+00,  1.00973894e+00,  1.00998695e+00,
+     1.01017020e+00,  1.01041097e+00,  1.01077665e+00,  1.01126582e+00,
+     1.01181148e+00,  1.01229458e+00,  1.01256180e+00,  1.01244309e+00,
+     1.01176194e+00,  1.01033424e+00,  1.00794908e+00,  1.00433993e+00,
+     9.99173905e-01,  9.91576784e-01,  9.80050312e-01,  9.63272669e-01,
+     9.37274180e-01,  8.98562363e-01,  8.42402641e-01,  7.64695273e-01,
+     6.63964248e-01,  5.43814697e-01,  4.13964292e-01,  2.88167883e-01,
+     1.79716277e-01,  9.71820717e-02,  4.26930905e-02,  1.28180356e-02,
+};
+
+static const float mdct_win_2m5_80[80+48] = {
+    -7.15790328e-04, -2.14085848e-03, -4.63902327e-03, -8.46579976e-03,
+    -1.37768432e-02, -2.06113109e-02, -2.88734336e-02, -3.83425799e-02,
+    -4.86956034e-02, -5.95339662e-02, -7.04034994e-02, -8.08207962e-02,
+    -9.03020368e-02, -9.83902326e-02, -1.04671927e-01, -1.08788246e-01,
+    -1.10431828e-01, -1.09347798e-01, -1.05305163e-01, -9.80748733e-02,
+    -8.74149008e-02, -7.30531247e-02, -5.46765131e-02, -3.19314399e-02,
+    -4.43893668e-03,  2.81940310e-02,  6.63364843e-02,  1.10295470e-01,
+     1.60283841e-01,  2.16459300e-01,  2.78889922e-01,  3.47987045e-01,
+     4.23230920e-01,  5.04735910e-01,  5.91651700e-01,  6.82394883e-01,
+     7.74282043e-01,  8.63441890e-01,  9.45121879e-01,  1.01445556e+00,
+     1.06754297e+00,  1.10242375e+00,  1.11958403e+00,  1.12162094e+00,
+     1.11244041e+00,  1.09630392e+00,  1.07709396e+00,  1.05785118e+00,
+     1.04087334e+00,  1.02634567e+00,  1.01528724e+00,  1.00730118e+00,
+     1.00160230e+00,  9.97401934e-01,  9.94177500e-01,  9.91760366e-01,
+     9.90007625e-01,  9.88802328e-01,  9.88049787e-01,  9.87668996e-01,
+     9.87584390e-01,  9.87723570e-01,  9.88015358e-01,  9.88392428e-01,
+     9.88793988e-01,  9.89170573e-01,  9.89488245e-01,  9.89731750e-01,
+     9.89907783e-01,  9.90044361e-01,  9.90187908e-01,  9.90397036e-01,
+     9.90732785e-01,  9.91251126e-01,  9.91994119e-01,  9.92984693e-01,
+     9.94223575e-01,  9.95687883e-01,  9.97333178e-01,  9.99096955e-01,
+     1.00090386e+00,  1.00267395e+00,  1.00433079e+00,  1.00580999e+00,
+     1.00706487e+00,  1.00807049e+00,  1.00882609e+00,  1.00935390e+00,
+     1.00969607e+00,  1.00990932e+00,  1.01005575e+00,  1.01019511e+00,
+     1.01037478e+00,  1.01062343e+00,  1.01094799e+00,  1.01133301e+00,
+     1.01174389e+00,  1.01213002e+00,  1.01242901e+00,  1.01257169e+00,
+     1.01248496e+00,  1.01209475e+00,  1.01132448e+00,  1.01009323e+00,
+     1.00830809e+00,  1.00585660e+00,  1.00260483e+00,  9.98400264e-01,
+     9.92751741e-01,  9.84942945e-01,  9.74330607e-01,  9.60731687e-01,
+     9.41127005e-01,  9.14871186e-01,  8.79797057e-01,  8.33933529e-01,
+     7.75677684e-01,  7.04343191e-01,  6.20786829e-01,  5.27854826e-01,
+     4.30272462e-01,  3.33956774e-01,  2.44867215e-01,  1.67876385e-01,
+     1.05948399e-01,  5.99593274e-02,  2.89216088e-02,  1.04616294e-02,
+};
+
+static const float mdct_win_2m5_120[120+72] = {
+    -5.48027082e-04, -1.31326568e-03, -2.47492377e-03, -4.13620565e-03,
+    -6.37368362e-03, -9.24594602e-03, -1.27855012e-02, -1.70074728e-02,
+    -2.18941669e-02, -2.74057319e-02, -3.34750014e-02, -4.00170270e-02,
+    -4.69245781e-02, -5.40825765e-02, -6.13566678e-02, -6.86108325e-02,
+    -7.56980661e-02, -8.24789988e-02, -8.88064003e-02, -9.45482407e-02,
+    -9.95729495e-02, -1.03766952e-01, -1.07019366e-01, -1.09241969e-01,
+    -1.10341020e-01, -1.10246536e-01, -1.08884758e-01, -1.06193751e-01,
+    -1.02102428e-01, -9.65436021e-02, -8.94411600e-02, -8.07152552e-02,
+    -7.02775792e-02, -5.80323828e-02, -4.38730116e-02, -2.76897745e-02,
+    -9.36830763e-03,  1.12111534e-02,  3.41594802e-02,  5.95825410e-02,
+     8.75748929e-02,  1.18200856e-01,  1.51510989e-01,  1.87597194e-01,
+     2.26427025e-01,  2.68045656e-01,  3.12600113e-01,  3.60169633e-01,
+     4.10254865e-01,  4.63242721e-01,  5.18877654e-01,  5.76845338e-01,
+     6.36686222e-01,  6.97720119e-01,  7.59038800e-01,  8.19488023e-01,
+     8.77708292e-01,  9.32240531e-01,  9.81611326e-01,  1.02451292e+00,
+     1.05993632e+00,  1.08728616e+00,  1.10646656e+00,  1.11786459e+00,
+     1.12226958e+00,  1.12075407e+00,  1.11456695e+00,  1.10498311e+00,
+     1.09322233e+00,  1.08036814e+00,  1.06732370e+00,  1.05484576e+00,
+     1.04374705e+00,  1.03304357e+00,  1.02423706e+00,  1.01688355e+00,
+     1.01099759e+00,  1.00611276e+00,  1.00241006e+00,  9.99368834e-01,
+     9.96801513e-01,  9.94654504e-01,  9.92877557e-01,  9.91425563e-01,
+     9.90258781e-01,  9.89342905e-01,  9.88647863e-01,  9.88147366e-01,
+     9.87817723e-01,  9.87636362e-01,  9.87581050e-01,  9.87630522e-01,
+     9.87763455e-01,  9.87959063e-01,  9.88197194e-01,  9.88459104e-01,
+     9.88727575e-01,  9.88987941e-01,  9.89228292e-01,  9.89440306e-01,
+     9.89619351e-01,  9.89765305e-01,  9.89882222e-01,  9.89978518e-01,
+     9.90066332e-01,  9.90161176e-01,  9.90280421e-01,  9.90442501e-01,
+     9.90665490e-01,  9.90966090e-01,  9.91358456e-01,  9.91853413e-01,
+     9.92457880e-01,  9.93174263e-01,  9.94000530e-01,  9.94929827e-01,
+     9.95951110e-01,  9.97048933e-01,  9.98204826e-01,  9.99397203e-01,
+     1.00060316e+00,  1.00179840e+00,  1.00295980e+00,  1.00406535e+00,
+     1.00509601e+00,  1.00603568e+00,  1.00687265e+00,  1.00759944e+00,
+     1.00821350e+00,  1.00871687e+00,  1.00911627e+00,  1.00942246e+00,
+     1.00964973e+00,  1.00981498e+00,  1.00993659e+00,  1.01003334e+00,
+     1.01012293e+00,  1.01022119e+00,  1.01034053e+00,  1.01048954e+00,
+     1.01067239e+00,  1.01088900e+00,  1.01113468e+00,  1.01140094e+00,
+     1.01167564e+00,  1.01194378e+00,  1.01218769e+00,  1.01238813e+00,
+     1.01252440e+00,  1.01257512e+00,  1.01251841e+00,  1.01233252e+00,
+     1.01199480e+00,  1.01148249e+00,  1.01077189e+00,  1.00983704e+00,
+     1.00864859e+00,  1.00717354e+00,  1.00537422e+00,  1.00320875e+00,
+     1.00063156e+00,  9.97595730e-01,  9.93924378e-01,  9.89122037e-01,
+     9.83396768e-01,  9.76336473e-01,  9.68013384e-01,  9.58086537e-01,
+     9.44826702e-01,  9.28974878e-01,  9.09692615e-01,  8.86340506e-01,
+     8.58328611e-01,  8.25118496e-01,  7.86293084e-01,  7.41632952e-01,
+     6.91214838e-01,  6.35466034e-01,  5.75236932e-01,  5.11763299e-01,
+     4.46615637e-01,  3.81569403e-01,  3.18456527e-01,  2.58987420e-01,
+     2.04625193e-01,  1.56459495e-01,  1.15161067e-01,  8.09839779e-02,
+     5.37973710e-02,  3.31428528e-02,  1.83124135e-02,  8.17433714e-03,
+};
+
+static const float mdct_win_5m_40[40+24] = {
+    -1.31326568e-03, -6.37368362e-03, -1.70074728e-02, -3.34750014e-02,
+    -5.40825765e-02, -7.56980661e-02, -9.45482407e-02, -1.07019366e-01,
+    -1.10246536e-01, -1.02102428e-01, -8.07152552e-02, -4.38730116e-02,
+     1.12111534e-02,  8.75748929e-02,  1.87597194e-01,  3.12600113e-01,
+     4.63242721e-01,  6.36686222e-01,  8.19488023e-01,  9.81611326e-01,
+     1.08728616e+00,  1.12226958e+00,  1.10498311e+00,  1.06732370e+00,
+     1.03304357e+00,  1.01099759e+00,  9.99368834e-01,  9.92877557e-01,
+     9.89342905e-01,  9.87817723e-01,  9.87630522e-01,  9.88197194e-01,
+     9.88987941e-01,  9.89619351e-01,  9.89978518e-01,  9.90280421e-01,
+     9.90966090e-01,  9.92457880e-01,  9.94929827e-01,  9.98204826e-01,
+     1.00179840e+00,  1.00509601e+00,  1.00759944e+00,  1.00911627e+00,
+     1.00981498e+00,  1.01012293e+00,  1.01048954e+00,  1.01113468e+00,
+     1.01194378e+00,  1.01252440e+00,  1.01233252e+00,  1.01077189e+00,
+     1.00717354e+00,  1.00063156e+00,  9.89122037e-01,  9.68013384e-01,
+     9.28974878e-01,  8.58328611e-01,  7.41632952e-01,  5.75236932e-01,
+     3.81569403e-01,  2.04625193e-01,  8.09839779e-02,  1.83124135e-02,
+};
+
+static const float mdct_win_5m_80[80+48] = {
+    -7.15790328e-04, -2.14085848e-03, -4.63902327e-03, -8.46579976e-03,
+    -1.37768432e-02, -2.06113109e-02, -2.88734336e-02, -3.83425799e-02,
+    -4.86956034e-02, -5.95339662e-02, -7.04034994e-02, -8.08207962e-02,
+    -9.03020368e-02, -9.83902326e-02, -1.04671927e-01, -1.08788246e-01,
+    -1.10431828e-01, -1.09347798e-01, -1.05305163e-01, -9.80748733e-02,
+    -8.74149008e-02, -7.30531247e-02, -5.46765131e-02, -3.19314399e-02,
+    -4.43893668e-03,  2.81940310e-02,  6.63364843e-02,  1.10295470e-01,
+     1.60283841e-01,  2.16459300e-01,  2.78889922e-01,  3.47987045e-01,
+     4.23230920e-01,  5.04735910e-01,  5.91651700e-01,  6.82394883e-01,
+     7.74282043e-01,  8.63441890e-01,  9.45121879e-01,  1.01445556e+00,
+     1.06754297e+00,  1.10242375e+00,  1.11958403e+00,  1.12162094e+00,
+     1.11244041e+00,  1.09630392e+00,  1.07709396e+00,  1.05785118e+00,
+     1.04087334e+00,  1.02634567e+00,  1.01528724e+00,  1.00730118e+00,
+     1.00160230e+00,  9.97401934e-01,  9.94177500e-01,  9.91760366e-01,
+     9.90007625e-01,  9.88802328e-01,  9.88049787e-01,  9.87668996e-01,
+     9.87584390e-01,  9.87723570e-01,  9.88015358e-01,  9.88392428e-01,
+     9.88793988e-01,  9.89170573e-01,  9.89488245e-01,  9.89731750e-01,
+     9.89907783e-01,  9.90044361e-01,  9.90187908e-01,  9.90397036e-01,
+     9.90732785e-01,  9.91251126e-01,  9.91994119e-01,  9.92984693e-01,
+     9.94223575e-01,  9.95687883e-01,  9.97333178e-01,  9.99096955e-01,
+     1.00090386e+00,  1.00267395e+00,  1.00433079e+00,  1.00580999e+00,
+     1.00706487e+00,  1.00807049e+00,  1.00882609e+00,  1.00935390e+00,
+     1.00969607e+00,  1.00990932e+00,  1.01005575e+00,  1.01019511e+00,
+     1.01037478e+00,  1.01062343e+00,  1.01094799e+00,  1.01133301e+00,
+     1.01174389e+00,  1.01213002e+00,  1.01242901e+00,  1.01257169e+00,
+     1.01248496e+00,  1.01209475e+00,  1.01132448e+00,  1.01009323e+00,
+     1.00830809e+00,  1.00585660e+00,  1.00260483e+00,  9.98400264e-01,
+     9.92751741e-01,  9.84942945e-01,  9.74330607e-01,  9.60731687e-01,
+     9.41127005e-01,  9.14871186e-01,  8.79797057e-01,  8.33933529e-01,
+     7.75677684e-01,  7.04343191e-01,  6.20786829e-01,  5.27854826e-01,
+     4.30272462e-01,  3.33956774e-01,  2.44867215e-01,  1.67876385e-01,
+     1.05948399e-01,  5.99593274e-02,  2.89216088e-02,  1.04616294e-02,
+};
+
+static const float mdct_win_5m_120[120+72] = {
+    -5.48027082e-04, -1.31326568e-03, -2.47492377e-03, -4.13620565e-03,
+    -6.37368362e-03, -9.24594602e-03, -1.27855012e-02, -1.70074728e-02,
+    -2.18941669e-02, -2.74057319e-02, -3.34750014e-02, -4.00170270e-02,
+    -4.69245781e-02, -5.40825765e-02, -6.13566678e-02, -6.86108325e-02,
+    -7.56980661e-02, -8.24789988e-02, -8.88064003e-02, -9.45482407e-02,
+    -9.95729495e-02, -1.03766952e-01, -1.07019366e-01, -1.09241969e-01,
+    -1.10341020e-01, -1.10246536e-01, -1.08884758e-01, -1.06193751e-01,
+    -1.02102428e-01, -9.65436021e-02, -8.94411600e-02, -8.07152552e-02,
+    -7.02775792e-02, -5.80323828e-02, -4.38730116e-02, -2.76897745e-02,
+    -9.36830763e-03,  1.12111534e-02,  3.41594802e-02,  5.95825410e-02,
+     8.75748929e-02,  1.18200856e-01,  1.51510989e-01,  1.87597194e-01,
+     2.26427025e-01,  2.68045656e-01,  3.12600113e-01,  3.60169633e-01,
+     4.10254865e-01,  4.63242721e-01,  5.18877654e-01,  5.76845338e-01,
+     6.36686222e-01,  6.97720119e-01,  7.59038800e-01,  8.19488023e-01,
+     8.77708292e-01,  9.32240531e-01,  9.81611326e-01,  1.02451292e+00,
+     1.05993632e+00,  1.08728616e+00,  1.10646656e+00,  1.11786459e+00,
+     1.12226958e+00,  1.12075407e+00,  1.11456695e+00,  1.10498311e+00,
+     1.09322233e+00,  1.08036814e+00,  1.06732370e+00,  1.05484576e+00,
+     1.04374705e+00,  1.03304357e+00,  1.02423706e+00,  1.01688355e+00,
+     1.01099759e+00,  1.00611276e+00,  1.00241006e+00,  9.99368834e-01,
+     9.96801513e-01,  9.94654504e-01,  9.92877557e-01,  9.91425563e-01,
+     9.90258781e-01,  9.89342905e-01,  9.88647863e-01,  9.88147366e-01,
+     9.87817723e-01,  9.87636362e-01,  9.87581050e-01,  9.87630522e-01,
+     9.87763455e-01,  9.87959063e-01,  9.88197194e-01,  9.88459104e-01,
+     9.88727575e-01,  9.88987941e-01,  9.89228292e-01,  9.89440306e-01,
+     9.89619351e-01,  9.89765305e-01,  9.89882222e-01,  9.89978518e-01,
+     9.90066332e-01,  9.90161176e-01,  9.90280421e-01,  9.90442501e-01,
+     9.90665490e-01,  9.90966090e-01,  9.91358456e-01,  9.91853413e-01,
+     9.92457880e-01,  9.93174263e-01,  9.94000530e-01,  9.94929827e-01,
+     9.95951110e-01,  9.97048933e-01,  9.98204826e-01,  9.99397203e-01,
+     1.00060316e+00,  1.00179840e+00,  1.00295980e+00,  1.00406535e+00,
+     1.00509601e+00,  1.00603568e+00,  1.00687265e+00,  1.00759944e+00,
+     1.00821350e+00,  1.00871687e+00,  1.00911627e+00,  1.00942246e+00,
+     1.00964973e+00,  1.00981498e+00,  1.00993659e+00,  1.01003334e+00,
+     1.01012293e+00,  1.01022119e+00,  1.01034053e+00,  1.01048954e+00,
+     1.01067239e+00,  1.01088900e+00,  1.01113468e+00,  1.01140094e+00,
+     1.01167564e+00,  1.01194378e+00,  1.01218769e+00,  1.01238813e+00,
+     1.01252440e+00,  1.01257512e+00,  1.01251841e+00,  1.01233252e+00,
+     1.01199480e+00,  1.01148249e+00,  1.01077189e+00,  1.00983704e+00,
+     1.00864859e+00,  1.00717354e+00,  1.00537422e+00,  1.00320875e+00,
+     1.00063156e+00,  9.97595730e-01,  9.93924378e-01,  9.89122037e-01,
+     9.83396768e-01,  9.76336473e-01,  9.68013384e-01,  9.58086537e-01,
+     9.44826702e-01,  9.28974878e-01,  9.09692615e-01,  8.86340506e-01,
+     8.58328611e-01,  8.25118496e-01,  7.86293084e-01,  7.41632952e-01,
+     6.91214838e-01,  6.35466034e-01,  5.75236932e-01,  5.11763299e-01,
+     4.46615637e-01,  3.81569403e-01,  3.18456527e-01,  2.58987420e-01,
+     2.04625193e-01,  1.56459495e-01,  1.15161067e-01,  8.09839779e-02,
+     5.37973710e-02,  3.31428528e-02,  1.83124135e-02,  8.17433714e-03,
+};
+
+static const float mdct_win_5m_160[160+96] = {
+    -4.64780535e-04, -9.86943436e-04, -1.69380265e-03, -2.65225161e-03,
+    -3.89764312e-03, -5.46338986e-03, -7.37470301e-03, -9.65355129e-03,
+    -1.23088432e-02, -1.53486546e-02, -1.87678815e-02, -2.25540349e-02,
+    -2.66875491e-02, -3.11402730e-02, -3.58790419e-02, -4.08629586e-02,
+    -4.60447265e-02, -5.13771887e-02, -5.68032414e-02, -6.22677803e-02,
+    -6.77114608e-02, -7.30699883e-02, -7.82871985e-02, -8.32995384e-02,
+    -8.80466235e-02, -9.24732012e-02, -9.65231080e-02, -1.00144067e-01,
+    -1.03289998e-01, -1.05911372e-01, -1.07972936e-01, -1.09435011e-01,
+    -1.10259912e-01, -1.10419276e-01, -1.09883075e-01, -1.08619072e-01,
+    -1.06603639e-01, -1.03805745e-01, -1.00195991e-01, -9.57469154e-02,
+    -9.04234315e-02, -8.41927909e-02, -7.70200918e-02, -6.88592357e-02,
+    -5.96744475e-02, -4.94213429e-02, -3.80517363e-02, -2.55204325e-02,
+    -1.17779085e-02,  3.22775003e-03,  1.95411153e-02,  3.72124855e-02,
+     5.62822679e-02,  7.67898106e-02,  9.87640387e-02,  1.22227995e-01,
+     1.47196388e-01,  1.73754705e-01,  2.01833658e-01,  2.31473870e-01,
+     2.62684620e-01,  2.95502784e-01,  3.30074453e-01,  3.66329664e-01,
+     4.03836330e-01,  4.43047869e-01,  4.83815240e-01,  5.26009110e-01,
+     5.69488746e-01,  6.14062841e-01,  6.59469476e-01,  7.05373595e-01,
+     7.51367784e-01,  7.96963754e-01,  8.41609425e-01,  8.84710987e-01,
+     9.25642198e-01,  9.63767146e-01,  9.98506439e-01,  1.02936211e+00,
+     1.05594459e+00,  1.07799781e+00,  1.09543054e+00,  1.10830575e+00,
+     1.11683711e+00,  1.12136346e+00,  1.12231635e+00,  1.12019701e+00,
+     1.11554205e+00,  1.10889025e+00,  1.10076484e+00,  1.09165922e+00,
+     1.08201110e+00,  1.07220145e+00,  1.06254883e+00,  1.05340080e+00,
+     1.04524672e+00,  1.03681465e+00,  1.02966908e+00,  1.02323044e+00,
+     1.01771755e+00,  1.01305327e+00,  1.00909876e+00,  1.00553193e+00,
+     1.00282399e+00,  1.00044800e+00,  9.98350287e-01,  9.96508631e-01,
+     9.94899787e-01,  9.93502330e-01,  9.92296637e-01,  9.91264685e-01,
+     9.90390373e-01,  9.89659389e-01,  9.89058576e-01,  9.88576113e-01,
+     9.88201211e-01,  9.87923782e-01,  9.87734335e-01,  9.87623509e-01,
+     9.87582149e-01,  9.87601247e-01,  9.87671737e-01,  9.87784810e-01,
+     9.87931810e-01,  9.88104121e-01,  9.88293608e-01,  9.88492608e-01,
+     9.88694231e-01,  9.88892259e-01,  9.89081121e-01,  9.89256586e-01,
+     9.89415565e-01,  9.89556112e-01,  9.89677792e-01,  9.89781287e-01,
+     9.89868809e-01,  9.89944002e-01,  9.90011546e-01,  9.90077490e-01,
+     9.90148486e-01,  9.90231792e-01,  9.90335288e-01,  9.90466679e-01,
+     9.90633646e-01,  9.90843208e-01,  9.91101493e-01,  9.91414030e-01,
+     9.91784950e-01,  9.92217286e-01,  9.92712826e-01,  9.93271153e-01,
+     9.93891071e-01,  9.94569674e-01,  9.95302679e-01,  9.96084576e-01,
+     9.96908262e-01,  9.97766003e-01,  9.98648991e-01,  9.99547736e-01,
+     1.00045247e+00,  1.00135284e+00,  1.00223900e+00,  1.00310133e+00,
+     1.00393082e+00,  1.00471949e+00,  1.00545998e+00,  1.00614648e+00,
+     1.00677443e+00,  1.00734067e+00,  1.00784376e+00,  1.00828310e+00,
+     1.00866033e+00,  1.00897840e+00,  1.00924141e+00,  1.00945491e+00,
+     1.00962508e+00,  1.00975903e+00,  1.00986457e+00,  1.00994953e+00,
+     1.01002195e+00,  1.01008923e+00,  1.01015815e+00,  1.01023488e+00,
+     1.01032421e+00,  1.01042987e+00,  1.01055411e+00,  1.01069766e+00,
+     1.01086009e+00,  1.01103942e+00,  1.01123251e+00,  1.01143505e+00,
+     1.01164135e+00,  1.01184505e+00,  1.01203909e+00,  1.01221561e+00,
+     1.01236625e+00,  1.01248215e+00,  1.01255441e+00,  1.01257399e+00,
+     1.01253159e+00,  1.01241798e+00,  1.01222384e+00,  1.01193966e+00,
+     1.01155590e+00,  1.01106246e+00,  1.01044866e+00,  1.00970287e+00,
+     1.00881229e+00,  1.00776317e+00,  1.00654017e+00,  1.00512636e+00,
+     1.00350360e+00,  1.00165244e+00,  9.99552199e-01,  9.97183964e-01,
+     9.94498500e-01,  9.90983279e-01,  9.87114924e-01,  9.82590898e-01,
+     9.77296959e-01,  9.71185813e-01,  9.64492546e-01,  9.56711924e-01,
+     9.46614153e-01,  9.35273506e-01,  9.22179989e-01,  9.07007510e-01,
+     8.89501821e-01,  8.69415611e-01,  8.46508587e-01,  8.20577806e-01,
+     7.91460889e-01,  7.59063377e-01,  7.23383553e-01,  6.84521734e-01,
+     6.42699133e-01,  5.98275912e-01,  5.51736295e-01,  5.03676200e-01,
+     4.54792180e-01,  4.05835620e-01,  3.57586682e-01,  3.10803520e-01,
+     2.66189445e-01,  2.24360744e-01,  1.85818690e-01,  1.50935241e-01,
+     1.19951973e-01,  9.29760719e-02,  6.99893645e-02,  5.08651627e-02,
+     3.53754490e-02,  2.32263917e-02,  1.40531828e-02,  7.02238243e-03,
+};
+
+static const float mdct_win_5m_240[240+144] = {
+    -3.51386274e-04, -7.15790328e-04, -1.09109190e-03, -1.56130492e-03,
+    -2.14085848e-03, -2.84003934e-03, -3.66938918e-03, -4.63902327e-03,
+    -5.75687113e-03, -7.03008937e-03, -8.46579976e-03, -1.00674027e-02,
+    -1.18367881e-02, -1.37768432e-02, -1.58883286e-02, -1.81674574e-02,
+    -2.06113109e-02, -2.32156800e-02, -2.59725217e-02, -2.88734336e-02,
+    -3.19094712e-02, -3.50698146e-02, -3.83425799e-02, -4.17138611e-02,
+    -4.51692288e-02, -4.86956034e-02, -5.22769814e-02, -5.58950221e-02,
+    -5.95339662e-02, -6.31780956e-02, -6.68075586e-02, -7.04034994e-02,
+    -7.39491613e-02, -7.74279503e-02, -8.08207962e-02, -8.41087632e-02,
+    -8.72744319e-02, -9.03020368e-02, -9.31751771e-02, -9.58764147e-02,
+    -9.83902326e-02, -1.00704258e-01, -1.02803272e-01, -1.04671927e-01,
+    -1.06299300e-01, -1.07675507e-01, -1.08788246e-01, -1.09626057e-01,
+    -1.10176644e-01, -1.10431828e-01, -1.10385898e-01, -1.10027994e-01,
+    -1.09347798e-01, -1.08339414e-01, -1.06995140e-01, -1.05305163e-01,
+    -1.03260501e-01, -1.00853025e-01, -9.80748733e-02, -9.49161087e-02,
+    -9.13661242e-02, -8.74149008e-02, -8.30533333e-02, -7.82704086e-02,
+    -7.30531247e-02, -6.73891676e-02, -6.12683347e-02, -5.46765131e-02,
+    -4.75983987e-02, -4.00212197e-02, -3.19314399e-02, -2.33144285e-02,
+    -1.41557905e-02, -4.43893668e-03,  5.84910172e-03,  1.67214374e-02,
+     2.81940310e-02,  4.02800023e-02,  5.29898617e-02,  6.63364843e-02,
+     8.03316087e-02,  9.49830459e-02,  1.10295470e-01,  1.26273503e-01,
+     1.42918788e-01,  1.60283841e-01,  1.78323247e-01,  1.97044513e-01,
+     2.16459300e-01,  2.36569237e-01,  2.57378066e-01,  2.78889922e-01,
+     3.01160600e-01,  3.24208889e-01,  3.47987045e-01,  3.72552569e-01,
+     3.97513207e-01,  4.23230920e-01,  4.49735261e-01,  4.76914094e-01,
+     5.04735910e-01,  5.33165733e-01,  5.62156611e-01,  5.91651700e-01,
+     6.21583167e-01,  6.51863967e-01,  6.82394883e-01,  7.13063964e-01,
+     7.43741422e-01,  7.74282043e-01,  8.04528029e-01,  8.34308865e-01,
+     8.63441890e-01,  8.91744535e-01,  9.19034449e-01,  9.45121879e-01,
+     9.69828462e-01,  9.92988246e-01,  1.01445556e+00,  1.03410060e+00,
+     1.05182209e+00,  1.06754297e+00,  1.08121902e+00,  1.09284001e+00,
+     1.10242375e+00,  1.11002039e+00,  1.11570651e+00,  1.11958403e+00,
+     1.12176980e+00,  1.12239840e+00,  1.12162094e+00,  1.11959500e+00,
+     1.11648123e+00,  1.11244041e+00,  1.10762934e+00,  1.10220122e+00,
+     1.09630392e+00,  1.09007298e+00,  1.08363136e+00,  1.07709396e+00,
+     1.07056129e+00,  1.06411880e+00,  1.05785118e+00,  1.05206842e+00,
+     1.04675488e+00,  1.04087334e+00,  1.03551461e+00,  1.03075627e+00,
+     1.02634567e+00,  1.02224259e+00,  1.01857153e+00,  1.01528724e+00,
+     1.01234920e+00,  1.00971730e+00,  1.00730118e+00,  1.00503561e+00,
+     1.00325094e+00,  1.00160230e+00,  1.00008259e+00,  9.98684725e-01,
+     9.97401934e-01,  9.96227454e-01,  9.95154704e-01,  9.94177500e-01,
+     9.93289633e-01,  9.92485801e-01,  9.91760366e-01,  9.91108628e-01,
+     9.90525659e-01,  9.90007625e-01,  9.89549987e-01,  9.89149540e-01,
+     9.88802328e-01,  9.88505462e-01,  9.88255562e-01,  9.88049787e-01,
+     9.87885257e-01,  9.87759361e-01,  9.87668996e-01,  9.87611470e-01,
+     9.87584241e-01,  9.87584390e-01,  9.87609542e-01,  9.87656731e-01,
+     9.87723570e-01,  9.87807259e-01,  9.87905475e-01,  9.88015358e-01,
+     9.88134793e-01,  9.88261191e-01,  9.88392428e-01,  9.88526258e-01,
+     9.88660715e-01,  9.88793988e-01,  9.88924359e-01,  9.89050348e-01,
+     9.89170573e-01,  9.89284263e-01,  9.89390256e-01,  9.89488245e-01,
+     9.89577716e-01,  9.89658871e-01,  9.89731750e-01,  9.89796985e-01,
+     9.89855249e-01,  9.89907783e-01,  9.89955766e-01,  9.90000609e-01,
+     9.90044361e-01,  9.90088682e-01,  9.90135925e-01,  9.90187908e-01,
+     9.90247338e-01,  9.90316172e-01,  9.90397036e-01,  9.90491805e-01,
+     9.90603127e-01,  9.90732785e-01,  9.90882905e-01,  9.91055094e-01,
+     9.91251126e-01,  9.91472296e-01,  9.91719643e-01,  9.91994119e-01,
+     9.92296260e-01,  9.92626543e-01,  9.92984693e-01,  9.93370715e-01,
+     9.93783906e-01,  9.94223575e-01,  9.94688341e-01,  9.95177026e-01,
+     9.95687883e-01,  9.96219018e-01,  9.96768236e-01,  9.97333178e-01,
+     9.97911555e-01,  9.98500314e-01,  9.99096955e-01,  9.99698314e-01,
+     1.00030178e+00,  1.00090386e+00,  1.00150194e+00,  1.00209282e+00,
+     1.00267395e+00,  1.00324224e+00,  1.00379533e+00,  1.00433079e+00,
+     1.00484635e+00,  1.00534002e+00,  1.00580999e+00,  1.00625498e+00,
+     1.00667353e+00,  1.00706487e+00,  1.00742823e+00,  1.00776355e+00,
+     1.00807049e+00,  1.00834949e+00,  1.00860105e+00,  1.00882609e+00,
+     1.00902564e+00,  1.00920098e+00,  1.00935390e+00,  1.00948601e+00,
+     1.00959947e+00,  1.00969607e+00,  1.00977852e+00,  1.00984871e+00,
+     1.00990932e+00,  1.00996234e+00,  1.01001054e+00,  1.01005575e+00,
+     1.01010039e+00,  1.01014614e+00,  1.01019511e+00,  1.01024872e+00,
+     1.01030819e+00,  1.01037478e+00,  1.01044918e+00,  1.01053205e+00,
+     1.01062343e+00,  1.01072352e+00,  1.01083181e+00,  1.01094799e+00,
+     1.01107087e+00,  1.01119968e+00,  1.01133301e+00,  1.01146934e+00,
+     1.01160692e+00,  1.01174389e+00,  1.01187825e+00,  1.01200768e+00,
+     1.01213002e+00,  1.01224259e+00,  1.01234324e+00,  1.01242901e+00,
+     1.01249753e+00,  1.01254591e+00,  1.01257169e+00,  1.01257185e+00,
+     1.01254393e+00,  1.01248496e+00,  1.01239233e+00,  1.01226331e+00,
+     1.01209475e+00,  1.01188401e+00,  1.01162820e+00,  1.01132448e+00,
+     1.01096948e+00,  1.01056037e+00,  1.01009323e+00,  1.00956496e+00,
+     1.00897114e+00,  1.00830809e+00,  1.00757109e+00,  1.00675570e+00,
+     1.00585660e+00,  1.00486889e+00,  1.00378683e+00,  1.00260483e+00,
+     1.00131701e+00,  9.99917416e-01,  9.98400264e-01,  9.96759593e-01,
+     9.94989619e-01,  9.92751741e-01,  9.90376213e-01,  9.87801444e-01,
+     9.84942945e-01,  9.81767081e-01,  9.78241382e-01,  9.74330607e-01,
+     9.70161449e-01,  9.65703423e-01,  9.60731687e-01,  9.55333500e-01,
+     9.48490892e-01,  9.41127005e-01,  9.33228627e-01,  9.24502922e-01,
+     9.14871186e-01,  9.04259171e-01,  8.92592160e-01,  8.79797057e-01,
+     8.65799707e-01,  8.50531835e-01,  8.33933529e-01,  8.15951373e-01,
+     7.96542190e-01,  7.75677684e-01,  7.53346356e-01,  7.29558492e-01,
+     7.04343191e-01,  6.77751747e-01,  6.49864002e-01,  6.20786829e-01,
+     5.90652606e-01,  5.59616906e-01,  5.27854826e-01,  4.95566527e-01,
+     4.62964803e-01,  4.30272462e-01,  3.97720274e-01,  3.65540106e-01,
+     3.33956774e-01,  3.03185267e-01,  2.73428040e-01,  2.44867215e-01,
+     2.17669164e-01,  1.91970010e-01,  1.67876385e-01,  1.45474412e-01,
+     1.24821354e-01,  1.05948399e-01,  8.88620703e-02,  7.35452725e-02,
+     5.99593274e-02,  4.80460555e-02,  3.77301212e-02,  2.89216088e-02,
+     2.15195187e-02,  1.54176870e-02,  1.04616294e-02,  5.33992322e-03,
+};
+
 const float *lc3_mdct_win[LC3_NUM_DT][LC3_NUM_SRATE] = {
 
+    [LC3_DT_2M5] = {
+        [LC3_SRATE_8K ] = LC3_WITH( 2500,  8000, mdct_win_2m5_20),
+        [LC3_SRATE_16K] = LC3_WITH( 2500, 16000, mdct_win_2m5_40),
+        [LC3_SRATE_24K] = LC3_WITH( 2500, 24000, mdct_win_2m5_60),
+        [LC3_SRATE_32K] = LC3_WITH( 2500, 32000, mdct_win_2m5_80),
+        [LC3_SRATE_48K] = LC3_WITH( 2500, 48000, mdct_win_2m5_120),
+    },
+
+    [LC3_DT_5M] = {
+        [LC3_SRATE_8K ] = LC3_WITH( 5000,  8000, mdct_win_5m_40),
+        [LC3_SRATE_16K] = LC3_WITH( 5000, 16000, mdct_win_5m_80),
+        [LC3_SRATE_24K] = LC3_WITH( 5000, 24000, mdct_win_5m_120),
+        [LC3_SRATE_32K] = LC3_WITH( 5000, 32000, mdct_win_5m_160),
+        [LC3_SRATE_48K] = LC3_WITH( 5000, 48000, mdct_win_5m_240),
+    },
+
     [LC3_DT_7M5] = {
-        [LC3_SRATE_8K ] = mdct_win_7m5_60,
-        [LC3_SRATE_16K] = mdct_win_7m5_120,
-        [LC3_SRATE_24K] = mdct_win_7m5_180,
-        [LC3_SRATE_32K] = mdct_win_7m5_240,
-        [LC3_SRATE_48K] = mdct_win_7m5_360,
+        [LC3_SRATE_8K ] = LC3_WITH( 7500,  8000, mdct_win_7m5_60),
+        [LC3_SRATE_16K] = LC3_WITH( 7500, 16000, mdct_win_7m5_120),
+        [LC3_SRATE_24K] = LC3_WITH( 7500, 24000, mdct_win_7m5_180),
+        [LC3_SRATE_32K] = LC3_WITH( 7500, 32000, mdct_win_7m5_240),
+        [LC3_SRATE_48K] = LC3_WITH( 7500, 48000, mdct_win_7m5_360),
     },
 
     [LC3_DT_10M] = {
-        [LC3_SRATE_8K ] = mdct_win_10m_80,
-        [LC3_SRATE_16K] = mdct_win_10m_160,
-        [LC3_SRATE_24K] = mdct_win_10m_240,
-        [LC3_SRATE_32K] = mdct_win_10m_320,
-        [LC3_SRATE_48K] = mdct_win_10m_480,
+        [LC3_SRATE_8K ] = LC3_WITH(10000,  8000, mdct_win_10m_80),
+        [LC3_SRATE_16K] = LC3_WITH(10000, 16000, mdct_win_10m_160),
+        [LC3_SRATE_24K] = LC3_WITH(10000, 24000, mdct_win_10m_240),
+        [LC3_SRATE_32K] = LC3_WITH(10000, 32000, mdct_win_10m_320),
+        [LC3_SRATE_48K] = LC3_WITH(10000, 48000, mdct_win_10m_480),
     },
 };
 
 
 /**
  * Bands limits (cf. 3.7.1-2)
+ *
+ * The limits of 2.5ms and 5ms frames are these of 10ms frames, scaled
+ * to the frame duration, and spread to bands of 1 coefficient at least.
  */
 
 const int lc3_band_lim[LC3_NUM_DT][LC3_NUM_SRATE][LC3_NUM_BANDS+1] = {
 
+    [LC3_DT_2M5] = {
+
+        [LC3_SRATE_8K ] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+             20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+             20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+             20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+             20,  20,  20,  20,  20                          },
+
+        [LC3_SRATE_16K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+             40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+             40,  40,  40,  40,  40                          },
+
+        [LC3_SRATE_24K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  41,  42,  43,  44,  45,  46,  47,  48,  49,
+             50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
+             60,  60,  60,  60,  60                          },
+
+        [LC3_SRATE_32K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  41,  42,  43,  44,  45,  46,  47,  48,  49,
+             50,  51,  52,  53,  54,  55,  56,  57,  58,  60,
+             63,  67,  71,  76,  80                          },
+
+        [LC3_SRATE_48K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  41,  42,  43,  44,  45,  46,  47,  48,  49,
+             50,  51,  52,  53,  54,  56,  60,  64,  68,  73,
+             78,  82,  88,  94, 100                          },
+
+    },
+
+    [LC3_DT_5M] = {
+
+        [LC3_SRATE_8K ] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+             40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+             40,  40,  40,  40,  40                          },
+
+        [LC3_SRATE_16K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  41,  42,  43,  44,  45,  46,  47,  48,  49,
+             50,  51,  52,  53,  54,  55,  56,  58,  60,  64,
+             66,  70,  73,  76,  80                          },
+
+        [LC3_SRATE_24K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  41,  42,  43,  44,  45,  46,  48,  50,  53,
+             56,  59,  62,  66,  70,  74,  78,  82,  86,  92,
+             96, 102, 108, 114, 120                          },
+
+        [LC3_SRATE_32K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+             40,  41,  43,  46,  48,  52,  54,  58,  62,  66,
+             70,  74,  78,  83,  88,  94, 100, 106, 112, 119,
+            126, 134, 142, 151, 160                          },
+
+        [LC3_SRATE_48K] = {
+              0,   1,   2,   3,   4,   5,   6,   7,   8,   9,
+             10,  11,  12,  13,  14,  15,  16,  17,  18,  19,
+             20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+             30,  31,  32,  33,  34,  35,  36,  37,  38,  40,
+             43,  46,  49,  52,  56,  60,  64,  68,  72,  77,
+             82,  88,  93,  99, 106, 112, 120, 128, 136, 146,
+            155, 165, 176, 188, 200                          },
+
+    },
+
     [LC3_DT_7M5] = {
 
         [LC3_SRATE_8K ] = {
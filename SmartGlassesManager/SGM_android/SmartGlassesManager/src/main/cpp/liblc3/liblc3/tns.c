@@ -19,6 +19,9 @@
 #include "tns.h"
 #include "tables.h"
 
+#include "tns_neon.h"
+#include "tns_sse.h"
+
 
 /* ----------------------------------------------------------------------------
  *  Filter Coefficients
@@ -26,12 +29,10 @@
 
 /**
  * Resolve LPC Weighting indication according bitrate
- * dt, nbytes      Duration and size of the frame
- * return          True when LPC Weighting enabled
  */
-static bool resolve_lpc_weighting(enum lc3_dt dt, int nbytes)
+bool lc3_tns_get_lpc_weighting(enum lc3_dt dt, int nbytes)
 {
-    return nbytes < (dt == LC3_DT_7M5 ? 360/8 : 480/8);
+    return nbytes < 15 * (1 + (int)dt);
 }
 
 /**
@@ -49,6 +50,19 @@ LC3_HOT static inline float dot(const float *a, const float *b, int n)
     return v;
 }
 
+/**
+ * Autocorrelation of a vector, for the lags 0 to 8
+ * x, n            The vector of size `n`, greater than 8
+ * r               Output the 9 values, sum( x[i] * x[i+k] ), k = [0..8]
+ */
+#ifndef autocorr
+LC3_HOT static inline void autocorr(const float *x, int n, float *r)
+{
+    for (int k = 0; k < 9; k++)
+        r[k] = dot(x, x + k, n - k);
+}
+#endif /* autocorr */
+
 /**
  * LPC Coefficients
  * dt, bw          Duration and bandwidth of the frame
@@ -59,6 +73,12 @@ LC3_HOT static void compute_lpc_coeffs(
     enum lc3_dt dt, enum lc3_bandwidth bw,
     const float *x, float *gain, float (*a)[9])
 {
+    static const int sub_5m_nb[]    = {  6, 17,  29,  40 };
+    static const int sub_5m_wb[]    = {  6, 31,  55,  80 };
+    static const int sub_5m_sswb[]  = {  6, 44,  82, 120 };
+    static const int sub_5m_swb[]   = {  6, 31,  55,  80, 107, 133, 160 };
+    static const int sub_5m_fb[]    = {  6, 37,  69, 100, 133, 167, 200 };
+
     static const int sub_7m5_nb[]   = {  9, 26,  43,  60 };
     static const int sub_7m5_wb[]   = {  9, 46,  83, 120 };
     static const int sub_7m5_sswb[] = {  9, 66, 123, 180 };
@@ -80,7 +100,11 @@ LC3_HOT static void compute_lpc_coeffs(
     };
 
     const int *sub = (const int * const [LC3_NUM_DT][LC3_NUM_SRATE]){
+        [LC3_DT_5M ] =
+        { sub_5m_nb , sub_5m_wb , sub_5m_sswb , sub_5m_swb , sub_5m_fb  },
+        [LC3_DT_7M5] =
         { sub_7m5_nb, sub_7m5_wb, sub_7m5_sswb, sub_7m5_swb, sub_7m5_fb },
+        [LC3_DT_10M] =
         { sub_10m_nb, sub_10m_wb, sub_10m_sswb, sub_10m_swb, sub_10m_fb },
     }[dt][bw];
 
@@ -90,21 +114,19 @@ LC3_HOT static void compute_lpc_coeffs(
     float r[2][9];
 
     for (int f = 0; f < nfilters; f++) {
-        float c[9][3];
+        float c[3][9];
 
         for (int s = 0; s < 3; s++) {
             xs = xe, xe = x + *(++sub);
-
-            for (int k = 0; k < 9; k++)
-                c[k][s] = dot(xs, xs + k, (xe - xs) - k);
+            autocorr(xs, xe - xs, c[s]);
         }
 
-        float e0 = c[0][0], e1 = c[0][1], e2 = c[0][2];
+        float e0 = c[0][0], e1 = c[1][0], e2 = c[2][0];
 
         r[f][0] = 3;
         for (int k = 1; k < 9; k++)
             r[f][k] = e0 == 0 || e1 == 0 || e2 == 0 ? 0 :
-                (c[k][0]/e0 + c[k][1]/e1 + c[k][2]/e2) * lag_window[k];
+                (c[0][k]/e0 + c[1][k]/e1 + c[2][k]/e2) * lag_window[k];
     }
 
     /* --- Levinson-Durbin recursion --- */
@@ -252,13 +274,14 @@ static void unquantize_rc(const int *rc_q, int rc_order, float rc[8])
  * rc_order, rc    Order of coefficients, and coefficients
  * x               Spectral coefficients, filtered as output
  */
+#ifndef forward_filtering
 LC3_HOT static void forward_filtering(
     enum lc3_dt dt, enum lc3_bandwidth bw,
     const int rc_order[2], const float rc[2][8], float *x)
 {
     int nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
     int nf = LC3_NE(dt, bw) >> (nfilters - 1);
-    int i0, ie = 3*(3 + dt);
+    int i0, ie = 3*(1 + dt);
 
     float s[8] = { 0 };
 
@@ -286,6 +309,7 @@ LC3_HOT static void forward_filtering(
         }
     }
 }
+#endif /* forward_filtering */
 
 /**
  * Inverse filtering
@@ -299,7 +323,7 @@ LC3_HOT static void inverse_filtering(
 {
     int nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
     int nf = LC3_NE(dt, bw) >> (nfilters - 1);
-    int i0, ie = 3*(3 + dt);
+    int i0, ie = 3*(1 + dt);
 
     float s[8] = { 0 };
 
@@ -339,25 +363,33 @@ LC3_HOT static void inverse_filtering(
 void lc3_tns_analyze(enum lc3_dt dt, enum lc3_bandwidth bw,
     bool nn_flag, int nbytes, struct lc3_tns_data *data, float *x)
 {
+    LC3_BIND_DT(dt);
+
     /* Processing steps :
      * - Determine the LPC (Linear Predictive Coding) Coefficients
      * - Check is the filtering is disabled
      * - The coefficients are weighted on low bitrates and predicition gain
      * - Convert to reflection coefficients and quantize
-     * - Finally filter the spectral coefficients */
+     * - Finally filter the spectral coefficients
+     *
+     * The filtering is not run on 2.5ms frames, their subdivisions
+     * are too short to estimate the coefficients */
 
     float pred_gain[2], a[2][9];
     float rc[2][8];
 
+    bool disabled = nn_flag || dt == LC3_DT_2M5;
+
     data->nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
-    data->lpc_weighting = resolve_lpc_weighting(dt, nbytes);
+    data->lpc_weighting = lc3_tns_get_lpc_weighting(dt, nbytes);
 
-    compute_lpc_coeffs(dt, bw, x, pred_gain, a);
+    if (!disabled)
+        compute_lpc_coeffs(dt, bw, x, pred_gain, a);
 
     for (int f = 0; f < data->nfilters; f++) {
 
         data->rc_order[f] = 0;
-        if (nn_flag || pred_gain[f] <= 1.5f)
+        if (disabled || pred_gain[f] <= 1.5f)
             continue;
 
         if (data->lpc_weighting && pred_gain[f] < 2.f)
@@ -378,6 +410,8 @@ void lc3_tns_analyze(enum lc3_dt dt, enum lc3_bandwidth bw,
 void lc3_tns_synthesize(enum lc3_dt dt, enum lc3_bandwidth bw,
     const struct lc3_tns_data *data, float *x)
 {
+    LC3_BIND_DT(dt);
+
     float rc[2][8] = { };
 
     for (int f = 0; f < data->nfilters; f++)
@@ -438,8 +472,10 @@ void lc3_tns_put_data(lc3_bits_t *bits, const struct lc3_tns_data *data)
 void lc3_tns_get_data(lc3_bits_t *bits,
     enum lc3_dt dt, enum lc3_bandwidth bw, int nbytes, lc3_tns_data_t *data)
 {
+    LC3_BIND_DT(dt);
+
     data->nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
-    data->lpc_weighting = resolve_lpc_weighting(dt, nbytes);
+    data->lpc_weighting = lc3_tns_get_lpc_weighting(dt, nbytes);
 
     for (int f = 0; f < data->nfilters; f++) {
 
@@ -46,6 +46,13 @@ typedef struct lc3_tns_data {
  *  Encoding
  * -------------------------------------------------------------------------- */
 
+/**
+ * Resolve LPC Weighting indication according bitrate
+ * dt, nbytes      Duration and size of the frame
+ * return          True when LPC Weighting enabled
+ */
+bool lc3_tns_get_lpc_weighting(enum lc3_dt dt, int nbytes);
+
 /**
  * TNS analysis
  * dt, bw          Duration and bandwidth of the frame
@@ -0,0 +1,178 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __ARM_NEON && __ARM_ARCH_ISA_A64 && \
+        !defined(TEST_ARM) || defined(TEST_NEON)
+
+#ifndef TEST_NEON
+#include <arm_neon.h>
+#endif /* TEST_NEON */
+
+
+/**
+ * Autocorrelation of a vector, for the lags 0 to 8
+ */
+#ifndef autocorr
+
+LC3_HOT static inline void neon_autocorr(const float *x, int n, float *r)
+{
+    float32x4_t r0 = vdupq_n_f32(0), r4 = vdupq_n_f32(0);
+    float r8 = 0;
+    int i;
+
+    /* --- The lags are accumulated together, sample by sample,
+     *     in the order of a dot product by lag --- */
+
+    for (i = 0; i < n - 8; i++) {
+        r0 = vaddq_f32(r0, vmulq_n_f32(vld1q_f32(x + i + 0), x[i]));
+        r4 = vaddq_f32(r4, vmulq_n_f32(vld1q_f32(x + i + 4), x[i]));
+        r8 += x[i] * x[i + 8];
+    }
+
+    /* --- The last samples, followed by zeros --- */
+
+    float xe[16] = { 0 };
+    memcpy(xe, x + i, 8 * sizeof(*x));
+
+    for (i = 0; i < 8; i++) {
+        r0 = vaddq_f32(r0, vmulq_n_f32(vld1q_f32(xe + i + 0), xe[i]));
+        r4 = vaddq_f32(r4, vmulq_n_f32(vld1q_f32(xe + i + 4), xe[i]));
+    }
+
+    vst1q_f32(r + 0, r0);
+    vst1q_f32(r + 4, r4);
+    r[8] = r8;
+}
+
+#ifndef TEST_NEON
+#define autocorr neon_autocorr
+#endif
+
+#endif /* autocorr */
+
+/**
+ * Forward filtering
+ */
+#ifndef forward_filtering
+
+/**
+ * Mask of the lanes `k` in range `k0 <= k <= k1`
+ */
+static inline void neon_lanes_mask(
+    int k0, int k1, uint32x4_t *lo, uint32x4_t *hi)
+{
+    static const int32_t k[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    int32x4_t v0 = vdupq_n_s32(k0), v1 = vdupq_n_s32(k1);
+
+    int32x4_t k_lo = vld1q_s32(k + 0);
+    int32x4_t k_hi = vld1q_s32(k + 4);
+
+    *lo = vandq_u32(vcgeq_s32(k_lo, v0), vcleq_s32(k_lo, v1));
+    *hi = vandq_u32(vcgeq_s32(k_hi, v0), vcleq_s32(k_hi, v1));
+}
+
+LC3_HOT static void neon_forward_filtering(
+    enum lc3_dt dt, enum lc3_bandwidth bw,
+    const int rc_order[2], const float rc[2][8], float *x)
+{
+    int nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
+    int nf = LC3_NE(dt, bw) >> (nfilters - 1);
+    int i0, ie = 3*(1 + dt);
+
+    float32x4_t s_lo = vdupq_n_f32(0), s_hi = vdupq_n_f32(0);
+
+    for (int f = 0; f < nfilters; f++) {
+
+        i0 = ie;
+        ie = nf * (1 + f);
+
+        if (!rc_order[f])
+            continue;
+
+        /* --- Coefficients, null above the order ---
+         * The unused stages pass through their inputs */
+
+        float r[8] = { 0 };
+        memcpy(r, rc[f], rc_order[f] * sizeof(*r));
+
+        float32x4_t r_lo = vld1q_f32(r + 0);
+        float32x4_t r_hi = vld1q_f32(r + 4);
+
+        float32x4_t sf_lo = s_lo, sf_hi = s_hi;
+
+        /* --- Run the pipeline ---
+         * The stages are run on 8 lanes of 2 vectors, the lane `k` runs
+         * the stage `k` on the sample `t - k` at step `t`. The results
+         * move up to the next lanes, for the next step. The idle stages,
+         * filling and emptying the pipeline, keep their state. */
+
+        float32x4_t x_lo = vdupq_n_f32(0), x_hi = vdupq_n_f32(0);
+        float32x4_t s1_lo = vdupq_n_f32(0), s1_hi = vdupq_n_f32(0);
+
+        float *xf = x + i0;
+        int n = ie - i0;
+
+        for (int t = 0; t < n + 7; t++) {
+            float32x4_t xt = vdupq_n_f32(t < n ? xf[t] : 0);
+
+            x_hi = vextq_f32(x_lo, x_hi, 3);
+            x_lo = vextq_f32(xt, x_lo, 3);
+
+            s1_hi = vextq_f32(s1_lo, s1_hi, 3);
+            s1_lo = vextq_f32(xt, s1_lo, 3);
+
+            float32x4_t s0_lo = s_lo, s0_hi = s_hi;
+
+            if (t >= 7 && t < n) {
+                s_lo = s1_lo, s_hi = s1_hi;
+            } else {
+                uint32x4_t m_lo, m_hi;
+                neon_lanes_mask(t - n + 1, t, &m_lo, &m_hi);
+
+                s_lo = vbslq_f32(m_lo, s1_lo, s_lo);
+                s_hi = vbslq_f32(m_hi, s1_hi, s_hi);
+            }
+
+            s1_lo = vaddq_f32(vmulq_f32(r_lo, x_lo), s0_lo);
+            s1_hi = vaddq_f32(vmulq_f32(r_hi, x_hi), s0_hi);
+
+            x_lo = vaddq_f32(x_lo, vmulq_f32(r_lo, s0_lo));
+            x_hi = vaddq_f32(x_hi, vmulq_f32(r_hi, s0_hi));
+
+            if (t >= 7)
+                xf[t - 7] = vgetq_lane_f32(x_hi, 3);
+        }
+
+        /* --- The states above the order are left unchanged --- */
+
+        uint32x4_t m_lo, m_hi;
+        neon_lanes_mask(0, rc_order[f] - 1, &m_lo, &m_hi);
+
+        s_lo = vbslq_f32(m_lo, s_lo, sf_lo);
+        s_hi = vbslq_f32(m_hi, s_hi, sf_hi);
+    }
+}
+
+#ifndef TEST_NEON
+#define forward_filtering neon_forward_filtering
+#endif
+
+#endif /* forward_filtering */
+
+#endif /* __ARM_NEON && __ARM_ARCH_ISA_A64 */
@@ -0,0 +1,196 @@
+/******************************************************************************
+ *
+ *  Copyright 2022 Google LLC
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __SSE2__ || defined(TEST_SSE)
+
+#ifndef TEST_SSE
+#include <emmintrin.h>
+#endif /* TEST_SSE */
+
+
+/**
+ * Autocorrelation of a vector, for the lags 0 to 8
+ */
+#ifndef autocorr
+
+LC3_HOT static inline void sse_autocorr(const float *x, int n, float *r)
+{
+    __m128 r0 = _mm_setzero_ps(), r4 = _mm_setzero_ps();
+    float r8 = 0;
+    int i;
+
+    /* --- The lags are accumulated together, sample by sample,
+     *     in the order of a dot product by lag --- */
+
+    for (i = 0; i < n - 8; i++) {
+        __m128 xi = _mm_set1_ps(x[i]);
+
+        r0 = _mm_add_ps(r0, _mm_mul_ps(xi, _mm_loadu_ps(x + i + 0)));
+        r4 = _mm_add_ps(r4, _mm_mul_ps(xi, _mm_loadu_ps(x + i + 4)));
+        r8 += x[i] * x[i + 8];
+    }
+
+    /* --- The last samples, followed by zeros --- */
+
+    float xe[16] = { 0 };
+    memcpy(xe, x + i, 8 * sizeof(*x));
+
+    for (i = 0; i < 8; i++) {
+        __m128 xi = _mm_set1_ps(xe[i]);
+
+        r0 = _mm_add_ps(r0, _mm_mul_ps(xi, _mm_loadu_ps(xe + i + 0)));
+        r4 = _mm_add_ps(r4, _mm_mul_ps(xi, _mm_loadu_ps(xe + i + 4)));
+    }
+
+    _mm_storeu_ps(r + 0, r0);
+    _mm_storeu_ps(r + 4, r4);
+    r[8] = r8;
+}
+
+#ifndef TEST_SSE
+#define autocorr sse_autocorr
+#endif
+
+#endif /* autocorr */
+
+/**
+ * Forward filtering
+ */
+#ifndef forward_filtering
+
+/**
+ * Move the lanes up, the lane 0 is taken from `v`
+ */
+static inline void sse_lanes_up(__m128 *lo, __m128 *hi, __m128 v)
+{
+    *hi = _mm_move_ss(_mm_shuffle_ps(*hi, *hi, _MM_SHUFFLE(2, 1, 0, 0)),
+                      _mm_shuffle_ps(*lo, *lo, _MM_SHUFFLE(3, 3, 3, 3)));
+    *lo = _mm_move_ss(_mm_shuffle_ps(*lo, *lo, _MM_SHUFFLE(2, 1, 0, 0)), v);
+}
+
+/**
+ * Select lanes of `a` where `mask` is set, and of `b` otherwise
+ */
+static inline __m128 sse_select(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/**
+ * Mask of the lanes `k` in range `k0 <= k <= k1`
+ */
+static inline void sse_lanes_mask(int k0, int k1, __m128 *lo, __m128 *hi)
+{
+    __m128i k_lo = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i k_hi = _mm_setr_epi32(4, 5, 6, 7);
+    __m128i v0 = _mm_set1_epi32(k0 - 1), v1 = _mm_set1_epi32(k1 + 1);
+
+    *lo = _mm_castsi128_ps(_mm_and_si128(
+        _mm_cmpgt_epi32(k_lo, v0), _mm_cmplt_epi32(k_lo, v1)));
+    *hi = _mm_castsi128_ps(_mm_and_si128(
+        _mm_cmpgt_epi32(k_hi, v0), _mm_cmplt_epi32(k_hi, v1)));
+}
+
+LC3_HOT static void sse_forward_filtering(
+    enum lc3_dt dt, enum lc3_bandwidth bw,
+    const int rc_order[2], const float rc[2][8], float *x)
+{
+    int nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
+    int nf = LC3_NE(dt, bw) >> (nfilters - 1);
+    int i0, ie = 3*(1 + dt);
+
+    __m128 s_lo = _mm_setzero_ps(), s_hi = _mm_setzero_ps();
+
+    for (int f = 0; f < nfilters; f++) {
+
+        i0 = ie;
+        ie = nf * (1 + f);
+
+        if (!rc_order[f])
+            continue;
+
+        /* --- Coefficients, null above the order ---
+         * The unused stages pass through their inputs */
+
+        float alignas(16) r[8] = { 0 };
+        memcpy(r, rc[f], rc_order[f] * sizeof(*r));
+
+        __m128 r_lo = _mm_load_ps(r + 0);
+        __m128 r_hi = _mm_load_ps(r + 4);
+
+        __m128 sf_lo = s_lo, sf_hi = s_hi;
+
+        /* --- Run the pipeline ---
+         * The stages are run on 8 lanes of 2 vectors, the lane `k` runs
+         * the stage `k` on the sample `t - k` at step `t`. The results
+         * move up to the next lanes, for the next step. The idle stages,
+         * filling and emptying the pipeline, keep their state. */
+
+        __m128 x_lo = _mm_setzero_ps(), x_hi = _mm_setzero_ps();
+        __m128 s1_lo = _mm_setzero_ps(), s1_hi = _mm_setzero_ps();
+
+        float *xf = x + i0;
+        int n = ie - i0;
+
+        for (int t = 0; t < n + 7; t++) {
+            __m128 xt = _mm_set_ss(t < n ? xf[t] : 0);
+
+            sse_lanes_up(&x_lo, &x_hi, xt);
+            sse_lanes_up(&s1_lo, &s1_hi, xt);
+
+            __m128 s0_lo = s_lo, s0_hi = s_hi;
+
+            if (t >= 7 && t < n) {
+                s_lo = s1_lo, s_hi = s1_hi;
+            } else {
+                __m128 m_lo, m_hi;
+                sse_lanes_mask(t - n + 1, t, &m_lo, &m_hi);
+
+                s_lo = sse_select(m_lo, s1_lo, s_lo);
+                s_hi = sse_select(m_hi, s1_hi, s_hi);
+            }
+
+            s1_lo = _mm_add_ps(_mm_mul_ps(r_lo, x_lo), s0_lo);
+            s1_hi = _mm_add_ps(_mm_mul_ps(r_hi, x_hi), s0_hi);
+
+            x_lo = _mm_add_ps(x_lo, _mm_mul_ps(r_lo, s0_lo));
+            x_hi = _mm_add_ps(x_hi, _mm_mul_ps(r_hi, s0_hi));
+
+            if (t >= 7)
+                xf[t - 7] = _mm_cvtss_f32(
+                    _mm_shuffle_ps(x_hi, x_hi, _MM_SHUFFLE(3, 3, 3, 3)));
+        }
+
+        /* --- The states above the order are left unchanged --- */
+
+        __m128 m_lo, m_hi;
+        sse_lanes_mask(0, rc_order[f] - 1, &m_lo, &m_hi);
+
+        s_lo = sse_select(m_lo, s_lo, sf_lo);
+        s_hi = sse_select(m_hi, s_hi, sf_hi);
+    }
+}
+
+#ifndef TEST_SSE
+#define forward_filtering sse_forward_filtering
+#endif
+
+#endif /* forward_filtering */
+
+#endif /* __SSE2__ */
@@ -84,11 +84,15 @@ typedef struct {
 } CommonState;
 
 struct DenoiseState {
-  float analysis_mem[FRAME_SIZE];
   float cepstral_mem[CEPS_MEM][NB_BANDS];
+  float cepstral_dist[CEPS_MEM][CEPS_MEM];
   int memid;
   float synthesis_mem[FRAME_SIZE];
-  float pitch_buf[PITCH_BUF_SIZE];
+  /* Input history, as a ring of PITCH_BUF_SIZE samples stored twice, so
+     that the PITCH_BUF_SIZE samples from pitch_pos are always contiguous.
+     Its last WINDOW_SIZE samples are the analysis window. */
+  float pitch_buf[2*PITCH_BUF_SIZE];
+  int pitch_pos;
   float pitch_enh_buf[PITCH_BUF_SIZE];
   float last_gain;
   int last_period;
@@ -122,6 +126,30 @@ void compute_band_energy(float *bandE, const kiss_fft_cpx *X) {
   }
 }
 
+static void compute_band_power(float *bandE, const float *power) {
+  int i;
+  float sum[NB_BANDS] = {0};
+  for (i=0;i<NB_BANDS-1;i++)
+  {
+    int j;
+    int band_size;
+    band_size = (eband5ms[i+1]-eband5ms[i])<<FRAME_SIZE_SHIFT;
+    for (j=0;j<band_size;j++) {
+      float tmp;
+      float frac = (float)j/band_size;
+      tmp = power[(eband5ms[i]<<FRAME_SIZE_SHIFT) + j];
+      sum[i] += (1-frac)*tmp;
+      sum[i+1] += frac*tmp;
+    }
+  }
+  sum[0] *= 2;
+  sum[NB_BANDS-1] *= 2;
+  for (i=0;i<NB_BANDS;i++)
+  {
+    bandE[i] = sum[i];
+  }
+}
+
 void compute_band_corr(float *bandE, const kiss_fft_cpx *X, const kiss_fft_cpx *P) {
   int i;
   float sum[NB_BANDS] = {0};
@@ -292,12 +320,24 @@ int lowpass = FREQ_SIZE;
 int band_lp = NB_BANDS;
 #endif
 
+static void push_history(DenoiseState *st, const float *in) {
+  int n = MIN32(FRAME_SIZE, PITCH_BUF_SIZE-st->pitch_pos);
+  float *buf = st->pitch_buf;
+  RNN_COPY(&buf[st->pitch_pos], in, n);
+  RNN_COPY(&buf[st->pitch_pos+PITCH_BUF_SIZE], in, n);
+  RNN_COPY(buf, &in[n], FRAME_SIZE-n);
+  RNN_COPY(&buf[PITCH_BUF_SIZE], &in[n], FRAME_SIZE-n);
+  st->pitch_pos += FRAME_SIZE;
+  if (st->pitch_pos >= PITCH_BUF_SIZE) st->pitch_pos -= PITCH_BUF_SIZE;
+}
+
 static void frame_analysis(DenoiseState *st, kiss_fft_cpx *X, float *Ex, const float *in) {
+#if TRAINING
   int i;
+#endif
   float x[WINDOW_SIZE];
-  RNN_COPY(x, st->analysis_mem, FRAME_SIZE);
-  for (i=0;i<FRAME_SIZE;i++) x[FRAME_SIZE + i] = in[i];
-  RNN_COPY(st->analysis_mem, in, FRAME_SIZE);
+  push_history(st, in);
+  RNN_COPY(x, &st->pitch_buf[st->pitch_pos+PITCH_BUF_SIZE-WINDOW_SIZE], WINDOW_SIZE);
   apply_window(x);
   forward_transform(X, x);
 #if TRAINING
@@ -307,40 +347,15 @@ static void frame_analysis(DenoiseState *st, kiss_fft_cpx *X, float *Ex, const f
   compute_band_energy(Ex, X);
 }
 
-static int compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cpx *P,
-                                  float *Ex, float *Ep, float *Exp, float *features, const float *in) {
+static int compute_band_features(DenoiseState *st, const float *Ex, const float *Exp,
+                                 int pitch_index, float *features) {
   int i;
   float E = 0;
   float *ceps_0, *ceps_1, *ceps_2;
   float spec_variability = 0;
   float Ly[NB_BANDS];
-  float p[WINDOW_SIZE];
-  float pitch_buf[PITCH_BUF_SIZE>>1];
-  int pitch_index;
-  float gain;
-  float *(pre[1]);
   float tmp[NB_BANDS];
   float follow, logMax;
-  frame_analysis(st, X, Ex, in);
-  RNN_MOVE(st->pitch_buf, &st->pitch_buf[FRAME_SIZE], PITCH_BUF_SIZE-FRAME_SIZE);
-  RNN_COPY(&st->pitch_buf[PITCH_BUF_SIZE-FRAME_SIZE], in, FRAME_SIZE);
-  pre[0] = &st->pitch_buf[0];
-  pitch_downsample(pre, pitch_buf, PITCH_BUF_SIZE, 1);
-  pitch_search(pitch_buf+(PITCH_MAX_PERIOD>>1), pitch_buf, PITCH_FRAME_SIZE,
-               PITCH_MAX_PERIOD-3*PITCH_MIN_PERIOD, &pitch_index);
-  pitch_index = PITCH_MAX_PERIOD-pitch_index;
-
-  gain = remove_doubling(pitch_buf, PITCH_MAX_PERIOD, PITCH_MIN_PERIOD,
-          PITCH_FRAME_SIZE, &pitch_index, st->last_period, st->last_gain);
-  st->last_period = pitch_index;
-  st->last_gain = gain;
-  for (i=0;i<WINDOW_SIZE;i++)
-    p[i] = st->pitch_buf[PITCH_BUF_SIZE-WINDOW_SIZE-pitch_index+i];
-  apply_window(p);
-  forward_transform(P, p);
-  compute_band_energy(Ep, P);
-  compute_band_corr(Exp, X, P);
-  for (i=0;i<NB_BANDS;i++) Exp[i] = Exp[i]/sqrt(.001+Ex[i]*Ep[i]);
   dct(tmp, Exp);
   for (i=0;i<NB_DELTA_CEPS;i++) features[NB_BANDS+2*NB_DELTA_CEPS+i] = tmp[i];
   features[NB_BANDS+2*NB_DELTA_CEPS] -= 1.3;
@@ -367,6 +382,20 @@ static int compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cp
   ceps_1 = (st->memid < 1) ? st->cepstral_mem[CEPS_MEM+st->memid-1] : st->cepstral_mem[st->memid-1];
   ceps_2 = (st->memid < 2) ? st->cepstral_mem[CEPS_MEM+st->memid-2] : st->cepstral_mem[st->memid-2];
   for (i=0;i<NB_BANDS;i++) ceps_0[i] = features[i];
+  /* Only the distances to the new frame change, the matrix is symmetric. */
+  for (i=0;i<CEPS_MEM;i++)
+  {
+    int k;
+    float dist=0;
+    for (k=0;k<NB_BANDS;k++)
+    {
+      float tmp;
+      tmp = st->cepstral_mem[i][k] - ceps_0[k];
+      dist += tmp*tmp;
+    }
+    st->cepstral_dist[st->memid][i] = dist;
+    st->cepstral_dist[i][st->memid] = dist;
+  }
   st->memid++;
   for (i=0;i<NB_DELTA_CEPS;i++) {
     features[i] = ceps_0[i] + ceps_1[i] + ceps_2[i];
@@ -381,16 +410,8 @@ static int compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cp
     float mindist = 1e15f;
     for (j=0;j<CEPS_MEM;j++)
     {
-      int k;
-      float dist=0;
-      for (k=0;k<NB_BANDS;k++)
-      {
-        float tmp;
-        tmp = st->cepstral_mem[i][k] - st->cepstral_mem[j][k];
-        dist += tmp*tmp;
-      }
       if (j!=i)
-        mindist = MIN32(mindist, dist);
+        mindist = MIN32(mindist, st->cepstral_dist[i][j]);
     }
     spec_variability += mindist;
   }
@@ -398,6 +419,37 @@ static int compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cp
   return TRAINING && E < 0.1;
 }
 
+static int compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cpx *P,
+                                  float *Ex, float *Ep, float *Exp, float *features, const float *in) {
+  int i;
+  const float *hist;
+  float p[WINDOW_SIZE];
+  float pitch_buf[PITCH_BUF_SIZE>>1];
+  int pitch_index;
+  float gain;
+  float *(pre[1]);
+  frame_analysis(st, X, Ex, in);
+  hist = &st->pitch_buf[st->pitch_pos];
+  pre[0] = (float *)hist;
+  pitch_downsample(pre, pitch_buf, PITCH_BUF_SIZE, 1);
+  pitch_search(pitch_buf+(PITCH_MAX_PERIOD>>1), pitch_buf, PITCH_FRAME_SIZE,
+               PITCH_MAX_PERIOD-3*PITCH_MIN_PERIOD, &pitch_index);
+  pitch_index = PITCH_MAX_PERIOD-pitch_index;
+
+  gain = remove_doubling(pitch_buf, PITCH_MAX_PERIOD, PITCH_MIN_PERIOD,
+          PITCH_FRAME_SIZE, &pitch_index, st->last_period, st->last_gain);
+  st->last_period = pitch_index;
+  st->last_gain = gain;
+  for (i=0;i<WINDOW_SIZE;i++)
+    p[i] = hist[PITCH_BUF_SIZE-WINDOW_SIZE-pitch_index+i];
+  apply_window(p);
+  forward_transform(P, p);
+  compute_band_energy(Ep, P);
+  compute_band_corr(Exp, X, P);
+  for (i=0;i<NB_BANDS;i++) Exp[i] = Exp[i]/sqrt(.001+Ex[i]*Ep[i]);
+  return compute_band_features(st, Ex, Exp, pitch_index, features);
+}
+
 static void frame_synthesis(DenoiseState *st, float *out, const kiss_fft_cpx *y) {
   float x[WINDOW_SIZE];
   int i;
@@ -455,41 +507,133 @@ void pitch_filter(kiss_fft_cpx *X, const kiss_fft_cpx *P, const float *Ex, const
   }
 }
 
-float rnnoise_process_frame(DenoiseState *st, float *out, const float *in) {
-  int i;
+typedef struct {
   kiss_fft_cpx X[FREQ_SIZE];
-  kiss_fft_cpx P[WINDOW_SIZE];
-  float x[FRAME_SIZE];
+  kiss_fft_cpx P[FREQ_SIZE];
   float Ex[NB_BANDS], Ep[NB_BANDS];
   float Exp[NB_BANDS];
   float features[NB_FEATURES];
   float g[NB_BANDS];
-  float gf[FREQ_SIZE]={1};
-  float vad_prob = 0;
+  float vad_prob;
   int silence;
+} FrameState;
+
+static void process_frame_analysis(DenoiseState *st, FrameState *f, const float *in) {
+  float x[FRAME_SIZE];
   static const float a_hp[2] = {-1.99599, 0.99600};
   static const float b_hp[2] = {-2, 1};
   biquad(x, st->mem_hp_x, in, b_hp, a_hp, FRAME_SIZE);
-  silence = compute_frame_features(st, X, P, Ex, Ep, Exp, features, x);
+  f->silence = compute_frame_features(st, f->X, f->P, f->Ex, f->Ep, f->Exp, f->features, x);
+  f->vad_prob = 0;
+}
 
-  if (!silence) {
-    compute_rnn(&st->rnn, g, &vad_prob, features);
-    pitch_filter(X, P, Ex, Ep, Exp, g);
+static void process_frame_synthesis(DenoiseState *st, FrameState *f, float *out) {
+  int i;
+  float gf[FREQ_SIZE]={1};
+
+  if (!f->silence) {
+    pitch_filter(f->X, f->P, f->Ex, f->Ep, f->Exp, f->g);
     for (i=0;i<NB_BANDS;i++) {
       float alpha = .6f;
-      g[i] = MAX16(g[i], alpha*st->lastg[i]);
-      st->lastg[i] = g[i];
+      f->g[i] = MAX16(f->g[i], alpha*st->lastg[i]);
+      st->lastg[i] = f->g[i];
     }
-    interp_band_gain(gf, g);
+    interp_band_gain(gf, f->g);
 #if 1
     for (i=0;i<FREQ_SIZE;i++) {
-      X[i].r *= gf[i];
-      X[i].i *= gf[i];
+      f->X[i].r *= gf[i];
+      f->X[i].i *= gf[i];
     }
 #endif
   }
 
-  frame_synthesis(st, out, X);
+  frame_synthesis(st, out, f->X);
+}
+
+float rnnoise_process_frame(DenoiseState *st, float *out, const float *in) {
+  FrameState f;
+  process_frame_analysis(st, &f, in);
+  if (!f.silence)
+    compute_rnn(&st->rnn, f.g, &f.vad_prob, f.features);
+  process_frame_synthesis(st, &f, out);
+  return f.vad_prob;
+}
+
+float rnnoise_process_frame_vad(DenoiseState *st, const float *in) {
+  FrameState f;
+  process_frame_analysis(st, &f, in);
+  if (!f.silence)
+    compute_rnn_vad(&st->rnn, &f.vad_prob, f.features);
+  /* The denoising branch is skipped, it restarts as after rnnoise_init(),
+     the first output frame fading in from the cleared synthesis memory. */
+  RNN_CLEAR(st->rnn.noise_gru_state, st->rnn.model->noise_gru_size);
+  RNN_CLEAR(st->rnn.denoise_gru_state, st->rnn.model->denoise_gru_size);
+  RNN_CLEAR(st->lastg, NB_BANDS);
+  RNN_CLEAR(st->synthesis_mem, FRAME_SIZE);
+  return f.vad_prob;
+}
+
+void rnnoise_process_frames(DenoiseState **st, float **out, const float **in, float *vad_prob, int n) {
+  int i, k;
+  for (k=0;k<n;k+=MAX_BATCH) {
+    FrameState f[MAX_BATCH];
+    RNNState *rnn[MAX_BATCH];
+    float *gains[MAX_BATCH];
+    float *vad[MAX_BATCH];
+    const float *features[MAX_BATCH];
+    const RNNModel *model = NULL;
+    int nb = MIN32(n-k, MAX_BATCH);
+    int B = 0;
+    for (i=0;i<nb;i++)
+      process_frame_analysis(st[k+i], &f[i], in[k+i]);
+    /* Silent frames skip the network. States using another model than the
+       first one of the batch are run alone. */
+    for (i=0;i<nb;i++) {
+      if (f[i].silence) continue;
+      if (!model) model = st[k+i]->rnn.model;
+      if (st[k+i]->rnn.model != model) {
+        compute_rnn(&st[k+i]->rnn, f[i].g, &f[i].vad_prob, f[i].features);
+        continue;
+      }
+      rnn[B] = &st[k+i]->rnn;
+      gains[B] = f[i].g;
+      vad[B] = &f[i].vad_prob;
+      features[B] = f[i].features;
+      B++;
+    }
+    if (B > 0)
+      compute_rnn_batch(rnn, gains, vad, features, B);
+    for (i=0;i<nb;i++) {
+      process_frame_synthesis(st[k+i], &f[i], out[k+i]);
+      if (vad_prob) vad_prob[k+i] = f[i].vad_prob;
+    }
+  }
+}
+
+float rnnoise_process_spectrum(DenoiseState *st, float *gains, const float *power,
+                               float pitch_corr, int pitch_period) {
+  int i;
+  float Ex[NB_BANDS], Exp[NB_BANDS];
+  float features[NB_FEATURES];
+  float g[NB_BANDS];
+  float vad_prob = 0;
+  compute_band_power(Ex, power);
+  /* The correlation with the pitch period is known as a whole, it stands
+     for the correlation of each band. */
+  for (i=0;i<NB_BANDS;i++) Exp[i] = pitch_corr;
+  pitch_period = MIN32(PITCH_MAX_PERIOD, MAX32(PITCH_MIN_PERIOD, pitch_period));
+  if (compute_band_features(st, Ex, Exp, pitch_period, features)) {
+    for (i=0;i<FREQ_SIZE;i++) gains[i] = 1;
+    return vad_prob;
+  }
+  compute_rnn(&st->rnn, g, &vad_prob, features);
+  for (i=0;i<NB_BANDS;i++) {
+    float alpha = .6f;
+    g[i] = MAX16(g[i], alpha*st->lastg[i]);
+    st->lastg[i] = g[i];
+  }
+  RNN_CLEAR(gains, FREQ_SIZE);
+  interp_band_gain(gains, g);
   return vad_prob;
 }
 
@@ -36,6 +36,7 @@
 #endif
 
 #include "_kiss_fft_guts.h"
+#include "kiss_fft_simd.h"
 #define CUSTOM_MODES
 
 /* The guts header contains all the multiplication and addition macros that are defined for
@@ -421,8 +422,13 @@ static void compute_twiddles(kiss_twiddle_cpx *twiddles, int nfft)
 }
 
 int opus_fft_alloc_arch_c(kiss_fft_state *st) {
+#ifdef KISS_FFT_SIMD
+   st->arch_fft = kf_simd_alloc(st);
+   return st->arch_fft == NULL;
+#else
    (void)st;
    return 0;
+#endif
 }
 
 /*
@@ -449,6 +455,7 @@ kiss_fft_state *opus_fft_alloc_twiddles(int nfft,void * mem,size_t * lenmem,
         kiss_twiddle_cpx *twiddles;
 
         st->nfft=nfft;
+        st->arch_fft=NULL;
 #ifdef FIXED_POINT
         st->scale_shift = celt_ilog2(st->nfft);
         if (st->nfft == 1<<st->scale_shift)
@@ -498,7 +505,12 @@ kiss_fft_state *opus_fft_alloc(int nfft,void * mem,size_t * lenmem, int arch)
 }
 
 void opus_fft_free_arch_c(kiss_fft_state *st) {
+#ifdef KISS_FFT_SIMD
+   kf_simd_free(st->arch_fft);
+   st->arch_fft = NULL;
+#else
    (void)st;
+#endif
 }
 
 void opus_fft_free(const kiss_fft_state *cfg, int arch)
@@ -542,6 +554,14 @@ void opus_fft_impl(const kiss_fft_state *st,kiss_fft_cpx *fout)
           m2 = st->factors[2*i-1];
        else
           m2 = 1;
+#ifdef KISS_FFT_SIMD
+       if (st->arch_fft && st->arch_fft->is_supported &&
+           kf_bfly_simd(fout, st, i, fstride[i]<<shift, m, fstride[i], m2))
+       {
+          m = m2;
+          continue;
+       }
+#endif
        switch (st->factors[2*i])
        {
        case 2:
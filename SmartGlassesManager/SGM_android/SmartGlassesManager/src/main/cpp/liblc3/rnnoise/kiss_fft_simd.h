@@ -0,0 +1,345 @@
+/**
+   @file kiss_fft_simd.h
+   @brief NEON and SSE2 radix butterflies of the float FFT
+
+   The butterflies process two complex values at a time, written once on
+   top of a few vector operations defined for each instruction set. The
+   twiddles of each stage are laid out at allocation, through the
+   opus_fft_alloc_arch_c() hook, so that they are read with vector loads.
+ */
+
+#ifndef KISS_FFT_SIMD_H
+#define KISS_FFT_SIMD_H
+
+#if !defined(FIXED_POINT) && (defined(__ARM_NEON) || defined(__SSE2__))
+#define KISS_FFT_SIMD
+#endif
+
+#ifdef KISS_FFT_SIMD
+
+/* Vector of 2 complex values, as {r0, i0, r1, i1} */
+
+#if defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+typedef float32x4_t kf_vec;
+
+#define kf_ld(p) vld1q_f32((const float *)(p))
+#define kf_st(p, v) vst1q_f32((float *)(p), v)
+#define kf_add(a, b) vaddq_f32(a, b)
+#define kf_sub(a, b) vsubq_f32(a, b)
+#define kf_mul(a, b) vmulq_f32(a, b)
+#define kf_dup(s) vdupq_n_f32(s)
+
+/* {r0, i0, r1, i1} -> {i0, r0, i1, r1} */
+#define kf_swap(a) vrev64q_f32(a)
+
+/* Low complex of a and b, high complex of a and b, low of a and high of b */
+#define kf_lo2(a, b) vcombine_f32(vget_low_f32(a), vget_low_f32(b))
+#define kf_hi2(a, b) vcombine_f32(vget_high_f32(a), vget_high_f32(b))
+#define kf_lohi(a, b) vcombine_f32(vget_low_f32(a), vget_high_f32(b))
+
+/* Multiplication by -i, {r, i} -> {i, -r} */
+static OPUS_INLINE kf_vec kf_negi(kf_vec a)
+{
+   static const float sign[4] = { 1, -1, 1, -1 };
+   return vmulq_f32(vrev64q_f32(a), vld1q_f32(sign));
+}
+
+#else /* __SSE2__ */
+
+#include <emmintrin.h>
+
+typedef __m128 kf_vec;
+
+#define kf_ld(p) _mm_loadu_ps((const float *)(p))
+#define kf_st(p, v) _mm_storeu_ps((float *)(p), v)
+#define kf_add(a, b) _mm_add_ps(a, b)
+#define kf_sub(a, b) _mm_sub_ps(a, b)
+#define kf_mul(a, b) _mm_mul_ps(a, b)
+#define kf_dup(s) _mm_set1_ps(s)
+
+/* {r0, i0, r1, i1} -> {i0, r0, i1, r1} */
+#define kf_swap(a) _mm_shuffle_ps(a, a, _MM_SHUFFLE(2,3,0,1))
+
+/* Low complex of a and b, high complex of a and b, low of a and high of b */
+#define kf_lo2(a, b) _mm_movelh_ps(a, b)
+#define kf_hi2(a, b) _mm_movehl_ps(b, a)
+#define kf_lohi(a, b) _mm_shuffle_ps(a, b, _MM_SHUFFLE(3,2,1,0))
+
+/* Multiplication by -i, {r, i} -> {i, -r} */
+static OPUS_INLINE kf_vec kf_negi(kf_vec a)
+{
+   return _mm_xor_ps(kf_swap(a), _mm_castsi128_ps(
+         _mm_set_epi32((int)0x80000000, 0, (int)0x80000000, 0)));
+}
+
+#endif
+
+/* Complex multiplication by a twiddle pair laid out as
+   {tr0, tr0, tr1, tr1}, {-ti0, ti0, -ti1, ti1} */
+static OPUS_INLINE kf_vec kf_cmul(kf_vec a, const float *tw)
+{
+   return kf_add(kf_mul(a, kf_ld(tw)), kf_mul(kf_swap(a), kf_ld(tw + 4)));
+}
+
+#define KF_TW_SIZE 8
+
+typedef struct {
+   /* Twiddles of each stage, p-1 pairs for each 2 values of m, or NULL
+      when the stage is left to the scalar butterflies */
+   float *tw[MAXFACTORS];
+} kf_simd_state;
+
+static void kf_simd_free(arch_fft_state *arch)
+{
+   int i;
+   kf_simd_state *simd;
+   if (!arch)
+      return;
+   simd = (kf_simd_state *)arch->priv;
+   if (simd)
+   {
+      for (i=0;i<MAXFACTORS;i++)
+         opus_free(simd->tw[i]);
+      opus_free(simd);
+   }
+   opus_free(arch);
+}
+
+static arch_fft_state *kf_simd_alloc(const kiss_fft_state *st)
+{
+   arch_fft_state *arch;
+   kf_simd_state *simd;
+   int fstride = 1;
+   int shift = st->shift>0 ? st->shift : 0;
+   int i = 0;
+
+   arch = (arch_fft_state *)opus_alloc(sizeof(*arch));
+   if (!arch)
+      return NULL;
+   arch->priv = simd = (kf_simd_state *)opus_alloc(sizeof(*simd));
+   if (!simd)
+      goto fail;
+   for (i=0;i<MAXFACTORS;i++)
+      simd->tw[i] = NULL;
+
+   for (i=0;i<MAXFACTORS;i++)
+   {
+      int p = st->factors[2*i];
+      int m = st->factors[2*i+1];
+      int j, k;
+      float *tw;
+
+      if (p == 3 || p == 4 || p == 5) {
+         if (m > 1 && (m & 1) == 0)
+         {
+            simd->tw[i] = tw = (float *)opus_alloc(
+                  sizeof(float)*KF_TW_SIZE/2*(p-1)*m);
+            if (!tw)
+               goto fail;
+            for (j=0;j<m;j+=2)
+               for (k=1;k<p;k++, tw+=KF_TW_SIZE)
+               {
+                  kiss_twiddle_cpx t0 = st->twiddles[k*j*(fstride<<shift)];
+                  kiss_twiddle_cpx t1 = st->twiddles[k*(j+1)*(fstride<<shift)];
+                  tw[0] = tw[1] = t0.r;
+                  tw[2] = tw[3] = t1.r;
+                  tw[4] = -t0.i; tw[5] = t0.i;
+                  tw[6] = -t1.i; tw[7] = t1.i;
+               }
+         }
+      }
+      fstride *= p;
+      if (m == 1)
+         break;
+   }
+
+   arch->is_supported = 1;
+   return arch;
+fail:
+   kf_simd_free(arch);
+   return NULL;
+}
+
+static void kf_bfly2_simd(kiss_fft_cpx *Fout, int m, int N)
+{
+   int i;
+   if (m==1)
+   {
+      for (i=0;i<N;i++)
+      {
+         kf_vec a = kf_ld(Fout);
+         kf_vec x = kf_lo2(a, a);
+         kf_vec y = kf_hi2(a, a);
+         kf_st(Fout, kf_lohi(kf_add(x, y), kf_sub(x, y)));
+         Fout += 2;
+      }
+   } else {
+      /* Twiddles exp(-i.pi.k/4), k = 0 to 3 */
+      static const float tw[2*KF_TW_SIZE] = {
+         1, 1, 0.7071067812f, 0.7071067812f,
+         0, 0, 0.7071067812f, -0.7071067812f,
+         0, 0, -0.7071067812f, -0.7071067812f,
+         1, -1, 0.7071067812f, -0.7071067812f };
+      celt_assert(m==4);
+      for (i=0;i<N;i++)
+      {
+         kf_vec a0 = kf_ld(Fout), a1 = kf_ld(Fout + 2);
+         kf_vec t0 = kf_cmul(kf_ld(Fout + 4), tw);
+         kf_vec t1 = kf_cmul(kf_ld(Fout + 6), tw + KF_TW_SIZE);
+         kf_st(Fout + 4, kf_sub(a0, t0));
+         kf_st(Fout + 6, kf_sub(a1, t1));
+         kf_st(Fout, kf_add(a0, t0));
+         kf_st(Fout + 2, kf_add(a1, t1));
+         Fout += 8;
+      }
+   }
+}
+
+static void kf_bfly4_simd(kiss_fft_cpx *Fout, const float *tw,
+                          int m, int N, int mm)
+{
+   int i, j;
+   if (m==1)
+   {
+      /* Degenerate case where all the twiddles are 1. */
+      for (i=0;i<N;i++)
+      {
+         kf_vec a = kf_ld(Fout), b = kf_ld(Fout + 2);
+         kf_vec s = kf_add(a, b), d = kf_sub(a, b);
+         kf_vec x = kf_lo2(s, d);
+         kf_vec y = kf_hi2(s, d);
+         y = kf_lohi(y, kf_negi(y));
+         kf_st(Fout, kf_add(x, y));
+         kf_st(Fout + 2, kf_sub(x, y));
+         Fout += 4;
+      }
+   } else {
+      kiss_fft_cpx *Fout_beg = Fout;
+      for (i=0;i<N;i++)
+      {
+         const float *t = tw;
+         Fout = Fout_beg + i*mm;
+         for (j=0;j<m;j+=2, t+=3*KF_TW_SIZE)
+         {
+            kf_vec s0 = kf_ld(Fout + j);
+            kf_vec s1 = kf_cmul(kf_ld(Fout + m + j), t);
+            kf_vec s2 = kf_cmul(kf_ld(Fout + 2*m + j), t + KF_TW_SIZE);
+            kf_vec s3 = kf_cmul(kf_ld(Fout + 3*m + j), t + 2*KF_TW_SIZE);
+            kf_vec s5 = kf_sub(s0, s2);
+            kf_vec s4 = kf_negi(kf_sub(s1, s3));
+            s0 = kf_add(s0, s2);
+            s1 = kf_add(s1, s3);
+            kf_st(Fout + j, kf_add(s0, s1));
+            kf_st(Fout + m + j, kf_add(s5, s4));
+            kf_st(Fout + 2*m + j, kf_sub(s0, s1));
+            kf_st(Fout + 3*m + j, kf_sub(s5, s4));
+         }
+      }
+   }
+}
+
+static void kf_bfly3_simd(kiss_fft_cpx *Fout, const float *tw,
+                          float epi3, int m, int N, int mm)
+{
+   int i, j;
+   kiss_fft_cpx *Fout_beg = Fout;
+   kf_vec half = kf_dup(.5f);
+   kf_vec e = kf_dup(epi3);
+   for (i=0;i<N;i++)
+   {
+      const float *t = tw;
+      Fout = Fout_beg + i*mm;
+      for (j=0;j<m;j+=2, t+=2*KF_TW_SIZE)
+      {
+         kf_vec s0 = kf_ld(Fout + j);
+         kf_vec s1 = kf_cmul(kf_ld(Fout + m + j), t);
+         kf_vec s2 = kf_cmul(kf_ld(Fout + 2*m + j), t + KF_TW_SIZE);
+         kf_vec s3 = kf_add(s1, s2);
+         kf_vec d = kf_negi(kf_mul(kf_sub(s1, s2), e));
+         kf_vec h = kf_sub(s0, kf_mul(s3, half));
+         kf_st(Fout + j, kf_add(s0, s3));
+         kf_st(Fout + m + j, kf_sub(h, d));
+         kf_st(Fout + 2*m + j, kf_add(h, d));
+      }
+   }
+}
+
+static void kf_bfly5_simd(kiss_fft_cpx *Fout, const float *tw,
+                          kiss_twiddle_cpx ya, kiss_twiddle_cpx yb,
+                          int m, int N, int mm)
+{
+   int i, u;
+   kiss_fft_cpx *Fout_beg = Fout;
+   kf_vec yar = kf_dup(ya.r), yai = kf_dup(ya.i);
+   kf_vec ybr = kf_dup(yb.r), ybi = kf_dup(yb.i);
+   for (i=0;i<N;i++)
+   {
+      const float *t = tw;
+      kiss_fft_cpx *Fout0 = Fout_beg + i*mm;
+      kiss_fft_cpx *Fout1 = Fout0 + m;
+      kiss_fft_cpx *Fout2 = Fout0 + 2*m;
+      kiss_fft_cpx *Fout3 = Fout0 + 3*m;
+      kiss_fft_cpx *Fout4 = Fout0 + 4*m;
+      for (u=0;u<m;u+=2, t+=4*KF_TW_SIZE)
+      {
+         kf_vec s0 = kf_ld(Fout0 + u);
+         kf_vec s1 = kf_cmul(kf_ld(Fout1 + u), t);
+         kf_vec s2 = kf_cmul(kf_ld(Fout2 + u), t + KF_TW_SIZE);
+         kf_vec s3 = kf_cmul(kf_ld(Fout3 + u), t + 2*KF_TW_SIZE);
+         kf_vec s4 = kf_cmul(kf_ld(Fout4 + u), t + 3*KF_TW_SIZE);
+         kf_vec s7 = kf_add(s1, s4), s10 = kf_sub(s1, s4);
+         kf_vec s8 = kf_add(s2, s3), s9 = kf_sub(s2, s3);
+         kf_vec s5, s6, s11, s12;
+
+         kf_st(Fout0 + u, kf_add(s0, kf_add(s7, s8)));
+
+         s5 = kf_add(s0, kf_add(kf_mul(s7, yar), kf_mul(s8, ybr)));
+         s6 = kf_negi(kf_add(kf_mul(s10, yai), kf_mul(s9, ybi)));
+         kf_st(Fout1 + u, kf_sub(s5, s6));
+         kf_st(Fout4 + u, kf_add(s5, s6));
+
+         s11 = kf_add(s0, kf_add(kf_mul(s7, ybr), kf_mul(s8, yar)));
+         s12 = kf_negi(kf_sub(kf_mul(s9, yai), kf_mul(s10, ybi)));
+         kf_st(Fout2 + u, kf_add(s11, s12));
+         kf_st(Fout3 + u, kf_sub(s11, s12));
+      }
+   }
+}
+
+/* Run stage `stage` of the FFT, return 0 when left to the scalar code */
+static int kf_bfly_simd(kiss_fft_cpx *Fout, const kiss_fft_state *st,
+                        int stage, int fstride, int m, int N, int mm)
+{
+   const kf_simd_state *simd = (const kf_simd_state *)st->arch_fft->priv;
+   const float *tw = simd->tw[stage];
+   switch (st->factors[2*stage])
+   {
+   case 2:
+      kf_bfly2_simd(Fout, m, N);
+      return 1;
+   case 4:
+      if (m > 1 && !tw)
+         return 0;
+      kf_bfly4_simd(Fout, tw, m, N, mm);
+      return 1;
+   case 3:
+      if (!tw)
+         return 0;
+      kf_bfly3_simd(Fout, tw, st->twiddles[fstride*m].i, m, N, mm);
+      return 1;
+   case 5:
+      if (!tw)
+         return 0;
+      kf_bfly5_simd(Fout, tw, st->twiddles[fstride*m],
+                    st->twiddles[fstride*2*m], m, N, mm);
+      return 1;
+   }
+   return 0;
+}
+
+#endif /* KISS_FFT_SIMD */
+
+#endif /* KISS_FFT_SIMD_H */
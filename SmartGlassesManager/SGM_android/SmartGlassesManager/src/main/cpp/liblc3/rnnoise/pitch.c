@@ -103,6 +103,7 @@ static void find_best_pitch(opus_val32 *xcorr, opus_val16 *y, int len,
    }
 }
 
+#ifndef OVERRIDE_CELT_FIR5
 static void celt_fir5(const opus_val16 *x,
          const opus_val16 *num,
          opus_val16 *y,
@@ -143,6 +144,7 @@ static void celt_fir5(const opus_val16 *x,
    mem[3]=mem3;
    mem[4]=mem4;
 }
+#endif /* OVERRIDE_CELT_FIR5 */
 
 
 void pitch_downsample(celt_sig *x[], opus_val16 *x_lp,
@@ -249,7 +251,12 @@ void celt_pitch_xcorr(const opus_val16 *_x, const opus_val16 *_y,
 #endif
    celt_assert(max_pitch>0);
    celt_assert((((unsigned char *)_x-(unsigned char *)NULL)&3)==0);
-   for (i=0;i<max_pitch-3;i+=4)
+   i=0;
+#ifdef OVERRIDE_XCORR_KERNEL16
+   for (;i<max_pitch-15;i+=16)
+      xcorr_kernel16(_x, _y+i, xcorr+i, len);
+#endif
+   for (;i<max_pitch-3;i+=4)
    {
       opus_val32 sum[4]={0,0,0,0};
       xcorr_kernel(_x, _y+i, sum, len);
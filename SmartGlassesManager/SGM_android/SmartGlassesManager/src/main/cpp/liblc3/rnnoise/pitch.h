@@ -37,6 +37,7 @@
 //#include "modes.h"
 //#include "cpu_support.h"
 #include "arch.h"
+#include "pitch_simd.h"
 
 void pitch_downsample(celt_sig *x[], opus_val16 *x_lp,
       int len, int C);
@@ -48,6 +49,7 @@ opus_val16 remove_doubling(opus_val16 *x, int maxperiod, int minperiod,
       int N, int *T0, int prev_period, opus_val16 prev_gain);
 
 
+#ifndef OVERRIDE_XCORR_KERNEL
 /* OPT: This is the kernel you really want to optimize. It gets used a lot
    by the prefilter and by the PLC. */
 static OPUS_INLINE void xcorr_kernel(const opus_val16 * x, const opus_val16 * y, opus_val32 sum[4], int len)
@@ -115,7 +117,9 @@ static OPUS_INLINE void xcorr_kernel(const opus_val16 * x, const opus_val16 * y,
       sum[3] = MAC16_16(sum[3],tmp,y_1);
    }
 }
+#endif /* OVERRIDE_XCORR_KERNEL */
 
+#ifndef OVERRIDE_DUAL_INNER_PROD
 static OPUS_INLINE void dual_inner_prod(const opus_val16 *x, const opus_val16 *y01, const opus_val16 *y02,
       int N, opus_val32 *xy1, opus_val32 *xy2)
 {
@@ -130,7 +134,9 @@ static OPUS_INLINE void dual_inner_prod(const opus_val16 *x, const opus_val16 *y
    *xy1 = xy01;
    *xy2 = xy02;
 }
+#endif /* OVERRIDE_DUAL_INNER_PROD */
 
+#ifndef OVERRIDE_CELT_INNER_PROD
 /*We make sure a C version is always available for cases where the overhead of
   vectorization and passing around an arch flag aren't worth it.*/
 static OPUS_INLINE opus_val32 celt_inner_prod(const opus_val16 *x,
@@ -142,6 +148,7 @@ static OPUS_INLINE opus_val32 celt_inner_prod(const opus_val16 *x,
       xy = MAC16_16(xy, x[i], y[i]);
    return xy;
 }
+#endif /* OVERRIDE_CELT_INNER_PROD */
 
 void celt_pitch_xcorr(const opus_val16 *_x, const opus_val16 *_y,
       opus_val32 *xcorr, int len, int max_pitch);
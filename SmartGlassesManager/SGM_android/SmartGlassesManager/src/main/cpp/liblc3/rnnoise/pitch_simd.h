@@ -0,0 +1,138 @@
+/**
+   @file pitch_simd.h
+   @brief NEON and SSE2 kernels of the float pitch analysis
+
+   The correlation kernels compute 4 or 16 lags at a time, with the lags in
+   the lanes of vectors. They carry celt_pitch_xcorr(), and so the
+   autocorrelation of _celt_autocorr(). Each lag adds its products in the
+   order of the C version, so that the results are the same bit for bit.
+   The inner products are left to the C version: reordering their sums
+   changes the decisions of remove_doubling().
+ */
+
+#ifndef PITCH_SIMD_H
+#define PITCH_SIMD_H
+
+#if !defined(FIXED_POINT) && (defined(__ARM_NEON) || defined(__SSE2__))
+#define PITCH_SIMD
+#endif
+
+#ifdef PITCH_SIMD
+
+#if defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+typedef float32x4_t pv_vec;
+
+#define pv_ld(p) vld1q_f32(p)
+#define pv_st(p, v) vst1q_f32(p, v)
+#define pv_add(a, b) vaddq_f32(a, b)
+#define pv_mul(a, b) vmulq_f32(a, b)
+#define pv_dup(s) vdupq_n_f32(s)
+#define pv_zero() vdupq_n_f32(0)
+
+#else /* __SSE2__ */
+
+#include <emmintrin.h>
+
+typedef __m128 pv_vec;
+
+#define pv_ld(p) _mm_loadu_ps(p)
+#define pv_st(p, v) _mm_storeu_ps(p, v)
+#define pv_add(a, b) _mm_add_ps(a, b)
+#define pv_mul(a, b) _mm_mul_ps(a, b)
+#define pv_dup(s) _mm_set1_ps(s)
+#define pv_zero() _mm_setzero_ps()
+
+#endif
+
+#define OVERRIDE_XCORR_KERNEL
+static OPUS_INLINE void xcorr_kernel(const opus_val16 * x, const opus_val16 * y, opus_val32 sum[4], int len)
+{
+   int j;
+   pv_vec sum0;
+   celt_assert(len>=3);
+   sum0 = pv_ld(sum);
+   /* One accumulator, so that each lag adds its products in the order of
+      the C version. y is read up to y[len+2], as by the C version */
+   for (j=0;j<len-3;j+=4)
+   {
+      sum0 = pv_add(sum0, pv_mul(pv_dup(x[j]), pv_ld(y+j)));
+      sum0 = pv_add(sum0, pv_mul(pv_dup(x[j+1]), pv_ld(y+j+1)));
+      sum0 = pv_add(sum0, pv_mul(pv_dup(x[j+2]), pv_ld(y+j+2)));
+      sum0 = pv_add(sum0, pv_mul(pv_dup(x[j+3]), pv_ld(y+j+3)));
+   }
+   for (;j<len;j++)
+      sum0 = pv_add(sum0, pv_mul(pv_dup(x[j]), pv_ld(y+j)));
+   pv_st(sum, sum0);
+}
+
+/* 16 lags at a time, for the correlation of the whole pitch range. Each
+   group of 4 lags keeps its own accumulator, added in the same order as
+   by xcorr_kernel(), and the 4 independent chains hide the latency of
+   the additions. y is read up to y[len+14]. */
+#define OVERRIDE_XCORR_KERNEL16
+static OPUS_INLINE void xcorr_kernel16(const opus_val16 * x, const opus_val16 * y, opus_val32 *sum, int len)
+{
+   int j;
+   pv_vec sum0 = pv_zero(), sum1 = pv_zero();
+   pv_vec sum2 = pv_zero(), sum3 = pv_zero();
+   for (j=0;j<len;j++)
+   {
+      pv_vec xj = pv_dup(x[j]);
+      sum0 = pv_add(sum0, pv_mul(xj, pv_ld(y+j)));
+      sum1 = pv_add(sum1, pv_mul(xj, pv_ld(y+j+4)));
+      sum2 = pv_add(sum2, pv_mul(xj, pv_ld(y+j+8)));
+      sum3 = pv_add(sum3, pv_mul(xj, pv_ld(y+j+12)));
+   }
+   pv_st(sum, sum0);
+   pv_st(sum+4, sum1);
+   pv_st(sum+8, sum2);
+   pv_st(sum+12, sum3);
+}
+
+/* 5 taps FIR filter, working in place (y == x). The outputs are computed 4
+   at a time from the end, so that the inputs still to be read are not yet
+   overwritten. Each output accumulates its taps in the order of the C
+   version. */
+#define OVERRIDE_CELT_FIR5
+static OPUS_INLINE void celt_fir5(const opus_val16 *x,
+         const opus_val16 *num,
+         opus_val16 *y,
+         int N,
+         opus_val16 *mem)
+{
+   int i, k;
+   opus_val16 mem_out[5];
+   pv_vec num0 = pv_dup(num[0]), num1 = pv_dup(num[1]);
+   pv_vec num2 = pv_dup(num[2]), num3 = pv_dup(num[3]);
+   pv_vec num4 = pv_dup(num[4]);
+   for (k=0;k<5;k++)
+      mem_out[k] = k < N ? x[N-1-k] : mem[k-N];
+   for (i=N;i-4>=5;)
+   {
+      pv_vec sum;
+      i -= 4;
+      sum = pv_ld(x+i);
+      sum = pv_add(sum, pv_mul(num0, pv_ld(x+i-1)));
+      sum = pv_add(sum, pv_mul(num1, pv_ld(x+i-2)));
+      sum = pv_add(sum, pv_mul(num2, pv_ld(x+i-3)));
+      sum = pv_add(sum, pv_mul(num3, pv_ld(x+i-4)));
+      sum = pv_add(sum, pv_mul(num4, pv_ld(x+i-5)));
+      pv_st(y+i, sum);
+   }
+   for (i--;i>=0;i--)
+   {
+      opus_val32 sum = SHL32(EXTEND32(x[i]), SIG_SHIFT);
+      for (k=0;k<5;k++)
+         sum = MAC16_16(sum, num[k], i-1-k >= 0 ? x[i-1-k] : mem[k-i]);
+      y[i] = ROUND16(sum, SIG_SHIFT);
+   }
+   for (k=0;k<5;k++)
+      mem[k] = mem_out[k];
+}
+
+#endif /* PITCH_SIMD */
+
+#endif /* PITCH_SIMD_H */
@@ -176,3 +176,164 @@ void compute_rnn(RNNState *rnn, float *gains, float *vad, const float *input) {
   compute_gru(rnn->model->denoise_gru, rnn->denoise_gru_state, denoise_input);
   compute_dense(rnn->model->denoise_output, gains, rnn->denoise_gru_state);
 }
+
+void compute_rnn_vad(RNNState *rnn, float *vad, const float *input) {
+  float dense_out[MAX_NEURONS];
+  compute_dense(rnn->model->input_dense, dense_out, input);
+  compute_gru(rnn->model->vad_gru, rnn->vad_gru_state, dense_out);
+  compute_dense(rnn->model->vad_output, vad, rnn->vad_gru_state);
+}
+
+/* Batched versions of the layers above, for independent streams sharing the
+   same model. Activations and states are interleaved by blocks of
+   BATCH_BLOCK streams, x[j*B + b] being the j-th value of stream b, with B
+   a multiple of BATCH_BLOCK so that the innermost loops have a constant
+   trip count and get vectorized. The weights are walked once, row by row,
+   and each of them is applied to all the streams. The accumulation order of
+   each stream is the same as in the single stream functions, so that the
+   results are identical. */
+
+#define BATCH_BLOCK 4
+
+static void compute_activation_batch(int activation, float *x, int N)
+{
+   int i;
+   if (activation == ACTIVATION_SIGMOID) {
+      for (i=0;i<N;i++)
+         x[i] = sigmoid_approx(x[i]);
+   } else if (activation == ACTIVATION_TANH) {
+      for (i=0;i<N;i++)
+         x[i] = tansig_approx(x[i]);
+   } else if (activation == ACTIVATION_RELU) {
+      for (i=0;i<N;i++)
+         x[i] = relu(x[i]);
+   } else {
+     *(int*)0=0;
+   }
+}
+
+/* sum[i*B + b] = bias[i] + sum_j w[j*stride + i]*x[j*B + b] (*r[j*B + b]),
+   for i < N and j < M. Without bias, the sums are continued. */
+static void accumulate_batch(float *sum, const rnn_weight *bias,
+                             const rnn_weight *w, int stride, const float *x,
+                             const float *r, int N, int M, int B)
+{
+   int i, j, b, k;
+   for (i=0;i<N;i++)
+   {
+      for (b=0;b<B;b+=BATCH_BLOCK)
+      {
+         float acc[BATCH_BLOCK];
+         for (k=0;k<BATCH_BLOCK;k++)
+            acc[k] = bias ? bias[i] : sum[i*B + b+k];
+         if (r) {
+            for (j=0;j<M;j++)
+            {
+               float wij = w[j*stride + i];
+               for (k=0;k<BATCH_BLOCK;k++)
+                  acc[k] += wij*x[j*B + b+k]*r[j*B + b+k];
+            }
+         } else {
+            for (j=0;j<M;j++)
+            {
+               float wij = w[j*stride + i];
+               for (k=0;k<BATCH_BLOCK;k++)
+                  acc[k] += wij*x[j*B + b+k];
+            }
+         }
+         for (k=0;k<BATCH_BLOCK;k++)
+            sum[i*B + b+k] = acc[k];
+      }
+   }
+}
+
+void compute_dense_batch(const DenseLayer *layer, float *output, const float *input, int B)
+{
+   int i;
+   int N, M;
+   M = layer->nb_inputs;
+   N = layer->nb_neurons;
+   accumulate_batch(output, layer->bias, layer->input_weights, N, input, NULL, N, M, B);
+   for (i=0;i<N*B;i++)
+      output[i] = WEIGHTS_SCALE*output[i];
+   compute_activation_batch(layer->activation, output, N*B);
+}
+
+void compute_gru_batch(const GRULayer *gru, float *state, const float *input, int B)
+{
+   int i;
+   int N, M;
+   int stride;
+   float zr[2*MAX_NEURONS*MAX_BATCH];
+   float h[MAX_NEURONS*MAX_BATCH];
+   const float *z, *r;
+   M = gru->nb_inputs;
+   N = gru->nb_neurons;
+   stride = 3*N;
+   /* Compute update and reset gates, the 2N first columns. */
+   accumulate_batch(zr, gru->bias, gru->input_weights, stride, input, NULL, 2*N, M, B);
+   accumulate_batch(zr, NULL, gru->recurrent_weights, stride, state, NULL, 2*N, N, B);
+   for (i=0;i<2*N*B;i++)
+      zr[i] = sigmoid_approx(WEIGHTS_SCALE*zr[i]);
+   z = zr;
+   r = zr + N*B;
+   /* Compute output. */
+   accumulate_batch(h, gru->bias + 2*N, gru->input_weights + 2*N, stride, input, NULL, N, M, B);
+   accumulate_batch(h, NULL, gru->recurrent_weights + 2*N, stride, state, r, N, N, B);
+   for (i=0;i<N*B;i++)
+      h[i] = WEIGHTS_SCALE*h[i];
+   compute_activation_batch(gru->activation, h, N*B);
+   for (i=0;i<N*B;i++)
+      state[i] = z[i]*state[i] + (1-z[i])*h[i];
+}
+
+void compute_rnn_batch(RNNState **rnn, float **gains, float **vad, const float **input, int nb) {
+  int i, b;
+  const RNNModel *model = rnn[0]->model;
+  /* Streams are padded with zeros up to a multiple of BATCH_BLOCK */
+  int B = (nb + BATCH_BLOCK-1) & ~(BATCH_BLOCK-1);
+  float in[INPUT_SIZE*MAX_BATCH];
+  float dense_out[MAX_NEURONS*MAX_BATCH];
+  float vad_out[MAX_BATCH];
+  float gains_out[MAX_NEURONS*MAX_BATCH];
+  float vad_state[MAX_NEURONS*MAX_BATCH];
+  float noise_state[MAX_NEURONS*MAX_BATCH];
+  float denoise_state[MAX_NEURONS*MAX_BATCH];
+  float noise_input[MAX_NEURONS*3*MAX_BATCH];
+  float denoise_input[MAX_NEURONS*3*MAX_BATCH];
+  if (nb == 1) {
+    /* Padding would only add work */
+    compute_rnn(rnn[0], gains[0], vad[0], input[0]);
+    return;
+  }
+  RNN_CLEAR(in, INPUT_SIZE*B);
+  RNN_CLEAR(vad_state, model->vad_gru_size*B);
+  RNN_CLEAR(noise_state, model->noise_gru_size*B);
+  RNN_CLEAR(denoise_state, model->denoise_gru_size*B);
+  for (b=0;b<nb;b++) {
+    for (i=0;i<INPUT_SIZE;i++) in[i*B + b] = input[b][i];
+    for (i=0;i<model->vad_gru_size;i++) vad_state[i*B + b] = rnn[b]->vad_gru_state[i];
+    for (i=0;i<model->noise_gru_size;i++) noise_state[i*B + b] = rnn[b]->noise_gru_state[i];
+    for (i=0;i<model->denoise_gru_size;i++) denoise_state[i*B + b] = rnn[b]->denoise_gru_state[i];
+  }
+  compute_dense_batch(model->input_dense, dense_out, in, B);
+  compute_gru_batch(model->vad_gru, vad_state, dense_out, B);
+  compute_dense_batch(model->vad_output, vad_out, vad_state, B);
+  RNN_COPY(noise_input, dense_out, model->input_dense_size*B);
+  RNN_COPY(noise_input + model->input_dense_size*B, vad_state, model->vad_gru_size*B);
+  RNN_COPY(noise_input + (model->input_dense_size+model->vad_gru_size)*B, in, INPUT_SIZE*B);
+  compute_gru_batch(model->noise_gru, noise_state, noise_input, B);
+
+  RNN_COPY(denoise_input, vad_state, model->vad_gru_size*B);
+  RNN_COPY(denoise_input + model->vad_gru_size*B, noise_state, model->noise_gru_size*B);
+  RNN_COPY(denoise_input + (model->vad_gru_size+model->noise_gru_size)*B, in, INPUT_SIZE*B);
+  compute_gru_batch(model->denoise_gru, denoise_state, denoise_input, B);
+  compute_dense_batch(model->denoise_output, gains_out, denoise_state, B);
+  for (b=0;b<nb;b++) {
+    vad[b][0] = vad_out[b];
+    for (i=0;i<model->denoise_output_size;i++) gains[b][i] = gains_out[i*B + b];
+    for (i=0;i<model->vad_gru_size;i++) rnn[b]->vad_gru_state[i] = vad_state[i*B + b];
+    for (i=0;i<model->noise_gru_size;i++) rnn[b]->noise_gru_state[i] = noise_state[i*B + b];
+    for (i=0;i<model->denoise_gru_size;i++) rnn[b]->denoise_gru_state[i] = denoise_state[i*B + b];
+  }
+}
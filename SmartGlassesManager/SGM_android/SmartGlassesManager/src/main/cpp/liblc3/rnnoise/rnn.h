@@ -35,6 +35,9 @@
 
 #define MAX_NEURONS 128
 
+/* Maximum number of streams run at once by the batched functions */
+#define MAX_BATCH 8
+
 #define ACTIVATION_TANH    0
 #define ACTIVATION_SIGMOID 1
 #define ACTIVATION_RELU    2
@@ -66,4 +69,12 @@ void compute_gru(const GRULayer *gru, float *state, const float *input);
 
 void compute_rnn(RNNState *rnn, float *gains, float *vad, const float *input);
 
+void compute_rnn_vad(RNNState *rnn, float *vad, const float *input);
+
+void compute_dense_batch(const DenseLayer *layer, float *output, const float *input, int B);
+
+void compute_gru_batch(const GRULayer *gru, float *state, const float *input, int B);
+
+void compute_rnn_batch(RNNState **rnn, float **gains, float **vad, const float **input, int B);
+
 #endif /* RNN_H_ */
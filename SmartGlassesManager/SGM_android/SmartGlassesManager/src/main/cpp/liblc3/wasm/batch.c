@@ -0,0 +1,74 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Batch decoding, exported by the WebAssembly module
+ *
+ * Crossing the JS / WebAssembly boundary for each 10 ms frame costs
+ * about as much as the decoding of a low samplerate frame. The frames
+ * received in a chunk are decoded by a single call.
+ */
+
+#include <lc3.h>
+
+#include "common.h"
+
+
+/**
+ * Decode consecutive frames
+ * decoder         Handle of the decoder
+ * in, nbytes      Input frames, and size in bytes of each frame
+ * nframes         Number of frames
+ * fmt             PCM output format
+ * pcm             Output PCM samples, the frames are written consecutively
+ * return          Number of frames concealed by PLC, -1: Wrong parameters
+ *
+ * The frame `n` is read at `in + n * nbytes`, and its samples are written
+ * at `pcm + n * lc3_frame_samples()`. When `in` is NULL, PLC is
+ * performed on `nframes` frames.
+ */
+int lc3_decode_frames(struct lc3_decoder *decoder, const void *in,
+    int nbytes, int nframes, enum lc3_pcm_format fmt, void *pcm)
+{
+    static const int pcm_bytes[] = {
+        [LC3_PCM_FORMAT_S16    ] = sizeof(int16_t),
+        [LC3_PCM_FORMAT_S24    ] = sizeof(int32_t),
+        [LC3_PCM_FORMAT_S24_3LE] = 3,
+        [LC3_PCM_FORMAT_FLOAT  ] = sizeof(float),
+    };
+
+    if (!decoder || nframes < 0 || (unsigned)fmt > LC3_PCM_FORMAT_FLOAT)
+        return -1;
+
+    int frame_bytes = LC3_NS(decoder->dt, decoder->sr_pcm) * pcm_bytes[fmt];
+    const uint8_t *p = in;
+    uint8_t *y = pcm;
+    int nplc = 0;
+
+    for (int i = 0; i < nframes; i++) {
+        int ret = lc3_decode(decoder, p, nbytes, fmt, y, 1);
+        if (ret < 0)
+            return -1;
+
+        nplc += ret;
+        y += frame_bytes;
+        if (p) p += nbytes;
+    }
+
+    return nplc;
+}
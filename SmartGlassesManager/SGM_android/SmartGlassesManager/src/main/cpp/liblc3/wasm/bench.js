@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 TeamOpenSmartGlasses
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Decoding benchmark of the WebAssembly modules
+//
+//   node bench.js [options] [<pcm>]
+//     -d <us>        Frame duration (10000)
+//     -r <hz>        Samplerate (16000)
+//     -b <bytes>     Size of the frames (20, as sent by the glasses)
+//     -n <count>     Number of decoding passes (20)
+//     -m <a.wasm>    First module (build/liblc3.wasm)
+//     -s <b.wasm>    Second module (build/liblc3_scalar.wasm)
+//
+// The PCM input is raw 16 bits mono at the samplerate; without it, 10 s
+// of synthetic signal are used. The input is encoded once by the second
+// module, and the same frames are decoded by both modules, by
+// `lc3_decode_frames()` when exported, or frame by frame otherwise.
+// The time per frame of each module is printed, and whether the decoded
+// samples of the two modules match.
+//
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+
+const PCM_FORMAT_S16 = 0;
+const PAGE_BYTES = 64 * 1024;
+
+function parseArgs(argv) {
+  const options = {
+    dt: 10000, sr: 16000, nbytes: 20, passes: 20, pcm: null,
+    modules: [
+      path.join(__dirname, 'build', 'liblc3.wasm'),
+      path.join(__dirname, 'build', 'liblc3_scalar.wasm'),
+    ],
+  };
+
+  for (let i = 0; i < argv.length; i++) {
+    const arg = argv[i];
+    if (!arg.startsWith('-')) {
+      options.pcm = arg;
+      continue;
+    }
+    const value = argv[++i];
+    if (value === undefined)
+      usage();
+    switch (arg) {
+      case '-d': options.dt = parseInt(value); break;
+      case '-r': options.sr = parseInt(value); break;
+      case '-b': options.nbytes = parseInt(value); break;
+      case '-n': options.passes = parseInt(value); break;
+      case '-m': options.modules[0] = value; break;
+      case '-s': options.modules[1] = value; break;
+      default: usage();
+    }
+  }
+
+  return options;
+}
+
+function usage() {
+  console.error('Usage: node bench.js [-d frame_us] [-r samplerate_hz]' +
+                ' [-b bytes] [-n passes]\n' +
+                '       [-m a.wasm] [-s b.wasm] [<pcm>]');
+  process.exit(1);
+}
+
+// Chirp from 100 Hz to 4 kHz in a light noise, repeated each second
+function synthesize(sr, nsamples) {
+  const pcm = new Int16Array(nsamples);
+  let seed = 1;
+  for (let i = 0; i < nsamples; i++) {
+    const t = (i % sr) / sr;
+    const phase = 2 * Math.PI * (100 * t + (3900 / 2) * t * t);
+    seed = (seed * 1103515245 + 12345) >>> 0;
+    const noise = (seed / 0x100000000 - 0.5) * 1000;
+    pcm[i] = Math.round(8000 * Math.sin(phase) + noise);
+  }
+  return pcm;
+}
+
+function readPcm(file) {
+  const data = fs.readFileSync(file);
+  return new Int16Array(data.buffer, data.byteOffset, data.length >> 1);
+}
+
+// Instance of a module, with its contexts and buffers in the memory
+class Codec {
+  constructor(file, options, nframes) {
+    const module = new WebAssembly.Module(fs.readFileSync(file));
+    this.name = path.basename(file);
+    this.exports = new WebAssembly.Instance(module, {}).exports;
+
+    const e = this.exports;
+    const ns = e.lc3_frame_samples(options.dt, options.sr);
+    if (ns < 0)
+      throw new Error(`${this.name}: bad frame duration or samplerate`);
+
+    const encoderSize = e.lc3_encoder_size(options.dt, options.sr);
+    const decoderSize = e.lc3_decoder_size(options.dt, options.sr);
+    const align = (n) => Math.ceil(n / 16) * 16;
+
+    const base = e.memory.buffer.byteLength;
+    this.encoder = base;
+    this.decoder = this.encoder + align(encoderSize);
+    this.frames = this.decoder + align(decoderSize);
+    this.pcm = this.frames + align(nframes * options.nbytes);
+    const end = this.pcm + nframes * ns * 2;
+    e.memory.grow(Math.ceil((end - base) / PAGE_BYTES));
+
+    this.ns = ns;
+    this.nbytes = options.nbytes;
+    this.nframes = nframes;
+    this.options = options;
+    this.batch = typeof e.lc3_decode_frames === 'function';
+
+    e.lc3_setup_encoder(options.dt, options.sr, 0, this.encoder);
+  }
+
+  bytes(ptr, length) {
+    return new Uint8Array(this.exports.memory.buffer, ptr, length);
+  }
+
+  samples() {
+    return new Int16Array(
+        this.exports.memory.buffer, this.pcm, this.nframes * this.ns);
+  }
+
+  encode(pcm) {
+    const e = this.exports;
+    this.samples().set(pcm.subarray(0, this.nframes * this.ns));
+    for (let i = 0; i < this.nframes; i++)
+      e.lc3_encode(this.encoder, PCM_FORMAT_S16, this.pcm + i * this.ns * 2,
+                   1, this.nbytes, this.frames + i * this.nbytes);
+    return this.bytes(this.frames, this.nframes * this.nbytes).slice();
+  }
+
+  // Decodes all the frames from a new decoder, returns the time spent
+  decode(frames) {
+    const e = this.exports;
+    const { dt, sr } = this.options;
+    this.bytes(this.frames, frames.length).set(frames);
+
+    const start = process.hrtime.bigint();
+    e.lc3_setup_decoder(dt, sr, 0, this.decoder);
+    if (this.batch) {
+      e.lc3_decode_frames(this.decoder, this.frames, this.nbytes,
+                          this.nframes, PCM_FORMAT_S16, this.pcm);
+    } else {
+      for (let i = 0; i < this.nframes; i++)
+        e.lc3_decode(this.decoder, this.frames + i * this.nbytes,
+                     this.nbytes, PCM_FORMAT_S16,
+                     this.pcm + i * this.ns * 2, 1);
+    }
+    return Number(process.hrtime.bigint() - start);
+  }
+}
+
+function main() {
+  const options = parseArgs(process.argv.slice(2));
+
+  const ns = Math.round(options.dt * options.sr / 1e6);
+  const input = options.pcm ? readPcm(options.pcm)
+                            : synthesize(options.sr, 10 * options.sr);
+  const nframes = Math.floor(input.length / ns);
+  if (nframes <= 0) {
+    console.error('Input too short');
+    process.exit(1);
+  }
+
+  const codecs = options.modules.map((file) => new Codec(file, options, nframes));
+  const frames = codecs[1].encode(input);
+
+  const outputs = [];
+  for (const codec of codecs) {
+    let best = Infinity;
+    for (let i = 0; i < options.passes; i++)
+      best = Math.min(best, codec.decode(frames));
+    outputs.push(codec.samples().slice());
+
+    console.log(`${codec.name.padEnd(20)} ${(best / nframes / 1e3).toFixed(2)}` +
+                ` us/frame (${codec.batch ? 'lc3_decode_frames' : 'lc3_decode'})`);
+  }
+
+  let maxdiff = 0, ndiff = 0;
+  for (let i = 0; i < outputs[0].length; i++) {
+    const diff = Math.abs(outputs[0][i] - outputs[1][i]);
+    maxdiff = Math.max(maxdiff, diff);
+    ndiff += diff > 0;
+  }
+
+  console.log(`${nframes} frames of ${options.nbytes} bytes, ` +
+              (ndiff === 0 ? 'outputs match' :
+               `outputs differ on ${ndiff} samples (max ${maxdiff})`));
+}
+
+main();
@@ -0,0 +1,89 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Freestanding math functions for the WebAssembly target
+ *
+ * The module is built without libc. The functions used by the codec
+ * are mapped to the corresponding instructions of the target,
+ * `ldexpf()` and `frexpf()` work on the binary representation,
+ * and `log10f()` is only used on constants, folded at compilation.
+ */
+
+#ifndef __LC3_WASM_MATH_H
+#define __LC3_WASM_MATH_H
+
+#include <stdint.h>
+
+#define INFINITY     __builtin_inff()
+
+#define fabsf(x)     __builtin_fabsf(x)
+#define floorf(x)    __builtin_floorf(x)
+#define ceilf(x)     __builtin_ceilf(x)
+#define sqrtf(x)     __builtin_sqrtf(x)
+#define fminf(x, y)  __builtin_fminf(x, y)
+#define fmaxf(x, y)  __builtin_fmaxf(x, y)
+#define log10f(x)    __builtin_log10f(x)
+
+
+/**
+ * Multiply by an integral power of 2
+ * x, e            Value, and exponent
+ * return          The value `x * 2^e`
+ */
+static inline float ldexpf(float x, int e)
+{
+    union { float f; uint32_t u; } s;
+
+    for ( ; e > 127; e -= 127)
+        x *= 0x1p127f;
+
+    for ( ; e < -126; e += 126)
+        x *= 0x1p-126f;
+
+    s.u = (uint32_t)(e + 127) << 23;
+    return x * s.f;
+}
+
+/**
+ * Break a value into normalized fraction and integral power of 2
+ * x               Value
+ * e               Return the exponent
+ * return          The fraction, in range [0.5, 1[, `x = fraction * 2^e`
+ */
+static inline float frexpf(float x, int *e)
+{
+    union { float f; uint32_t u; } s = { .f = x };
+    int ex = (s.u >> 23) & 0xff;
+
+    if (ex == 0xff || (ex == 0 && x == 0)) {
+        *e = 0;
+        return x;
+    }
+
+    if (ex == 0) {
+        s.f = x * 0x1p25f;
+        ex = ((s.u >> 23) & 0xff) - 25;
+    }
+
+    *e = ex - 126;
+    s.u = (s.u & 0x807fffff) | (126 << 23);
+    return s.f;
+}
+
+#endif /* __LC3_WASM_MATH_H */
@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ *  Copyright 2026 TeamOpenSmartGlasses
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Freestanding memory functions for the WebAssembly target
+ *
+ * Built with the bulk memory extension, the functions are lowered
+ * to the `memory.copy` and `memory.fill` instructions.
+ */
+
+#ifndef __LC3_WASM_STRING_H
+#define __LC3_WASM_STRING_H
+
+#include <stddef.h>
+
+#define memcpy(d, s, n)   __builtin_memcpy(d, s, n)
+#define memmove(d, s, n)  __builtin_memmove(d, s, n)
+#define memset(d, c, n)   __builtin_memset(d, c, n)
+
+#endif /* __LC3_WASM_STRING_H */
@@ -18,7 +18,56 @@ public class L3cCpp {
     public static native void freeEncoder(long encoderPtr);
     public static native byte[] encodeLC3(long encoderPtr, byte[] pcmData);
 
+    // Encoder complexity, 0: full (default), 1: medium, 2: low
+    public static final int COMPLEXITY_FULL = 0;
+    public static final int COMPLEXITY_MEDIUM = 1;
+    public static final int COMPLEXITY_LOW = 2;
+    public static native int setEncoderComplexity(long encoderPtr, int level);
+
+    // Noise suppression applied by the encoder, to be freed before the encoder
+    public static native long initDenoiser(long encoderPtr);
+    public static native void freeDenoiser(long denoiserPtr);
+    // Voice probability of the last frame, from 0 to 1
+    public static native float getDenoiserVad(long denoiserPtr);
+
     public static native long initDecoder();
     public static native void freeDecoder(long decoderPtr);
     public static native byte[] decodeLC3(long decoderPtr, byte[] lc3Data);
+
+    // Decoder mode, 0: playback (default), 1: reduced synthesis for speech recognition
+    public static final int DECODER_MODE_PLAYBACK = 0;
+    public static final int DECODER_MODE_ASR = 1;
+    public static native int setDecoderMode(long decoderPtr, int mode);
+
+    // Band energies in dB, 64 values per frame, for VAD or keyword spotting without decoding the audio
+    public static native float[] decodeLC3Energies(long decoderPtr, byte[] lc3Data);
+
+    // Encoder taking PCM at any samplerate and channel count
+    public static native long initFrontend(int sampleRateHz, int channels);
+    public static native void freeFrontend(long frontendPtr);
+    public static native byte[] encodeLC3Frontend(long frontendPtr, short[] pcmData);
+
+    // Link adaptive frame sizes, each frame is prefixed by its size byte
+    public static native long initRateControl(int minBytes, int maxBytes);
+    public static native void freeRateControl(long rateControlPtr);
+    public static native void updateLinkStats(long rateControlPtr, int queuedFrames, int sentFrames, int lostFrames, int throughputBps);
+    public static native byte[] encodeLC3Adaptive(long encoderPtr, long rateControlPtr, byte[] pcmData);
+    public static native byte[] decodeLC3Adaptive(long decoderPtr, byte[] lc3Data);
+
+    // Packets carrying a low rate copy of the frame `delay` packets before, decoded `delay` frames late
+    public static native long initFecEncoder(int frameBytes, int fecBytes, int delay);
+    public static native void freeFecEncoder(long fecEncoderPtr);
+    public static native byte[] encodeLC3Fec(long encoderPtr, long fecEncoderPtr, byte[] pcmData);
+    public static native long initFecDecoder(int frameBytes, int fecBytes, int delay);
+    public static native void freeFecDecoder(long fecDecoderPtr);
+    public static native byte[] decodeLC3Fec(long decoderPtr, long fecDecoderPtr, byte[] packet);
+
+    // Frames packed in notifications of packetSize bytes (ATT MTU - 3), with sequence numbers for loss detection
+    public static native long initPacketizer(int packetSize, boolean variableSize);
+    public static native void freePacketizer(long packetizerPtr);
+    public static native byte[][] encodeLC3Packets(long encoderPtr, long packetizerPtr, byte[] pcmData, int frameBytes);
+    public static native byte[] flushPacketizer(long packetizerPtr);
+    public static native long initDepacketizer();
+    public static native void freeDepacketizer(long depacketizerPtr);
+    public static native byte[] decodeLC3Packet(long decoderPtr, long depacketizerPtr, byte[] packet);
 }